@@ -54,10 +54,19 @@ NativeCallbackScope* NativeCallbackScopeManager::Open(NativeEngine* env)
 
 void NativeCallbackScopeManager::Close(NativeCallbackScope* scope)
 {
+    NativeEngine* env = nullptr;
     if (scope != nullptr) {
+        env = scope->GetEnv();
         delete scope;
     }
     asyncCallbackScopeDepth_--;
+
+    if (asyncCallbackScopeDepth_ == 0 && checkpointPending_) {
+        checkpointPending_ = false;
+        if (env != nullptr && !env->IsStopping()) {
+            env->RunMicrotasks();
+        }
+    }
 }
 
 size_t NativeCallbackScopeManager::IncrementOpenCallbackScopes()
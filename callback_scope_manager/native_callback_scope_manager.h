@@ -34,6 +34,10 @@ public:
     {
         failed_ = true;
     }
+    inline NativeEngine* GetEnv() const
+    {
+        return env_;
+    }
 
 private:
     bool closed_ = false;
@@ -62,9 +66,16 @@ public:
         return asyncCallbackScopeDepth_;
     }
 
+    // Defer the microtask checkpoint until the outermost scope closes
+    void MarkCheckpointPending()
+    {
+        checkpointPending_ = true;
+    }
+
 private:
     size_t openCallbackScopes_ = 0;
     size_t asyncCallbackScopeDepth_ = 0;
+    bool checkpointPending_ = false;
 };
 
 #endif /* FOUNDATION_ACE_NAPI_CALLBACK_SCOPE_MANAGER_NATIVE_CALLBACK_SCOPE_MANAGER_H */
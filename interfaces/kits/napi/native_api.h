@@ -233,4 +233,124 @@ NAPI_INNER_EXTERN napi_status node_api_get_module_file_name(napi_env env, const
 
 NAPI_EXTERN napi_status napi_run_script_path(napi_env env, const char* path, napi_value* result);
 
+NAPI_EXTERN napi_status napi_create_external_string_latin1(napi_env env,
+                                                           char* str,
+                                                           size_t length,
+                                                           napi_finalize finalize_callback,
+                                                           void* finalize_hint,
+                                                           napi_value* result,
+                                                           bool* copied);
+
+NAPI_EXTERN napi_status napi_create_external_string_utf16(napi_env env,
+                                                          char16_t* str,
+                                                          size_t length,
+                                                          napi_finalize finalize_callback,
+                                                          void* finalize_hint,
+                                                          napi_value* result,
+                                                          bool* copied);
+
+NAPI_EXTERN napi_status napi_get_value_string_utf8_view(napi_env env,
+                                                        napi_value value,
+                                                        const char** result,
+                                                        size_t* length);
+
+typedef struct napi_property_key__* napi_property_key;
+
+NAPI_EXTERN napi_status napi_create_property_key(napi_env env, const char* utf8name, napi_property_key* result);
+
+NAPI_EXTERN napi_status napi_delete_property_key(napi_env env, napi_property_key key);
+
+NAPI_EXTERN napi_status napi_get_property_by_key(napi_env env,
+                                                 napi_value object,
+                                                 napi_property_key key,
+                                                 napi_value* result);
+
+NAPI_EXTERN napi_status napi_set_property_by_key(napi_env env,
+                                                 napi_value object,
+                                                 napi_property_key key,
+                                                 napi_value value);
+
+NAPI_EXTERN napi_status napi_get_elements(napi_env env,
+                                          napi_value array,
+                                          uint32_t start,
+                                          uint32_t count,
+                                          napi_value* result);
+
+NAPI_EXTERN napi_status napi_set_elements(napi_env env,
+                                          napi_value array,
+                                          uint32_t start,
+                                          uint32_t count,
+                                          const napi_value* values);
+
+NAPI_EXTERN napi_status napi_get_elements_double(napi_env env,
+                                                 napi_value array,
+                                                 uint32_t start,
+                                                 uint32_t count,
+                                                 double* result);
+
+NAPI_EXTERN napi_status napi_get_elements_int32(napi_env env,
+                                                napi_value array,
+                                                uint32_t start,
+                                                uint32_t count,
+                                                int32_t* result);
+
+NAPI_EXTERN napi_status napi_get_elements_string_utf8_view(napi_env env,
+                                                           napi_value array,
+                                                           uint32_t start,
+                                                           uint32_t count,
+                                                           const char** result,
+                                                           size_t* lengths);
+
+NAPI_EXTERN napi_status napi_set_elements_double(napi_env env,
+                                                 napi_value array,
+                                                 uint32_t start,
+                                                 uint32_t count,
+                                                 const double* values);
+
+NAPI_EXTERN napi_status napi_set_elements_int32(napi_env env,
+                                                napi_value array,
+                                                uint32_t start,
+                                                uint32_t count,
+                                                const int32_t* values);
+
+NAPI_EXTERN napi_status napi_create_object_with_properties(napi_env env,
+                                                           napi_value prototype,
+                                                           const char** names,
+                                                           const napi_value* values,
+                                                           size_t count,
+                                                           napi_value* result);
+
+typedef struct napi_object_template__* napi_object_template;
+
+NAPI_EXTERN napi_status napi_create_object_template(napi_env env,
+                                                    const char** names,
+                                                    size_t count,
+                                                    napi_object_template* result);
+
+NAPI_EXTERN napi_status napi_delete_object_template(napi_env env, napi_object_template object_template);
+
+NAPI_EXTERN napi_status napi_new_object_from_template(napi_env env,
+                                                      napi_object_template object_template,
+                                                      const napi_value* values,
+                                                      napi_value* result);
+
+// The hash never changes while the object is alive, distinct objects may share one
+NAPI_EXTERN napi_status napi_get_object_identity_hash(napi_env env, napi_value object, uint32_t* result);
+
+typedef enum {
+    // Writes go to private copies of the touched pages, the file is never modified
+    napi_file_mapping_copy_on_write = 0,
+    // Reserved, script can write through any view of an ArrayBuffer so this returns napi_invalid_arg for now
+    napi_file_mapping_read_only = 1,
+} napi_file_mapping_mode;
+
+// Maps length bytes of the regular file starting at offset, a length of 0 maps up to the end of the file.
+// Pages are loaded on first access and unmapped once the ArrayBuffer is collected.
+NAPI_EXTERN napi_status napi_create_arraybuffer_from_file(napi_env env,
+                                                          const char* path,
+                                                          size_t offset,
+                                                          size_t length,
+                                                          napi_file_mapping_mode mode,
+                                                          napi_value* result);
+
 #endif /* FOUNDATION_ACE_NAPI_INTERFACES_KITS_NAPI_NATIVE_API_H */
@@ -22,6 +22,7 @@
 #include "core/common/container_scope.h"
 #endif
 
+#include "native_engine/native_argument_buffer.h"
 #include "native_engine/native_property.h"
 
 #include "native_value/ark_native_array.h"
@@ -42,6 +43,7 @@
 #endif
 #include "securec.h"
 #include "utils/log.h"
+#include "utils/unicode.h"
 
 using panda::JsiRuntimeCallInfo;
 using panda::BooleanRef;
@@ -56,11 +58,112 @@ using panda::PromiseCapabilityRef;
 using panda::NativePointerRef;
 using panda::SymbolRef;
 using panda::IntegerRef;
+using panda::NumberRef;
+using panda::ArrayRef;
+using panda::PropertyAttribute;
 using panda::DateRef;
 using panda::BigIntRef;
 using panda::JsiRuntimeCallInfo;
 static constexpr auto PANDA_MAIN_FUNCTION = "_GLOBAL::func_main_0";
 
+namespace {
+enum class ArkValueKind : uint8_t {
+    NUMBER,
+    STRING,
+    BOOLEAN,
+    NULL_VALUE,
+    UNDEFINED,
+    SYMBOL,
+    BIGINT,
+    ARRAY,
+    FUNCTION,
+    ARRAY_BUFFER,
+    DATA_VIEW,
+    TYPED_ARRAY,
+    EXTERNAL,
+    DATE,
+    OBJECT,
+    UNKNOWN,
+};
+
+// Primitives come first, they are the bulk of the arguments passed to native callbacks
+ArkValueKind GetArkValueKind(const EcmaVM* vm, Local<JSValueRef> value)
+{
+    if (value->IsNumber()) {
+        return ArkValueKind::NUMBER;
+    } else if (value->IsString()) {
+        return ArkValueKind::STRING;
+    } else if (value->IsBoolean()) {
+        return ArkValueKind::BOOLEAN;
+    } else if (value->IsUndefined()) {
+        return ArkValueKind::UNDEFINED;
+    } else if (value->IsNull()) {
+        return ArkValueKind::NULL_VALUE;
+    } else if (value->IsSymbol()) {
+        return ArkValueKind::SYMBOL;
+    } else if (value->IsBigInt()) {
+        return ArkValueKind::BIGINT;
+    } else if (value->IsArray(vm)) {
+        return ArkValueKind::ARRAY;
+    } else if (value->IsFunction()) {
+        return ArkValueKind::FUNCTION;
+    } else if (value->IsArrayBuffer()) {
+        return ArkValueKind::ARRAY_BUFFER;
+    } else if (value->IsDataView()) {
+        return ArkValueKind::DATA_VIEW;
+    } else if (value->IsTypedArray()) {
+        return ArkValueKind::TYPED_ARRAY;
+    } else if (value->IsNativePointer()) {
+        return ArkValueKind::EXTERNAL;
+    } else if (value->IsDate()) {
+        return ArkValueKind::DATE;
+    } else if (value->IsObject() || value->IsPromise()) {
+        return ArkValueKind::OBJECT;
+    }
+    return ArkValueKind::UNKNOWN;
+}
+
+template<typename T>
+NativeValue* CreateArkWrapper(ArkNativeEngine* engine, Local<JSValueRef> value)
+{
+    return new T(engine, value);
+}
+
+template<NativeValueType type>
+NativeValue* CreateArkValue(ArkNativeEngine* engine, Local<JSValueRef> value)
+{
+    return new ArkNativeValue(engine, value, type);
+}
+
+NativeValue* CreateArkObject(ArkNativeEngine* engine, Local<JSValueRef> value)
+{
+    return new ArkNativeObject(engine, value, NATIVE_OBJECT);
+}
+
+using ArkValueFactory = NativeValue* (*)(ArkNativeEngine* engine, Local<JSValueRef> value);
+
+// Indexed by ArkValueKind
+const ArkValueFactory ARK_VALUE_FACTORIES[] = {
+    CreateArkWrapper<ArkNativeNumber>,
+    CreateArkWrapper<ArkNativeString>,
+    CreateArkWrapper<ArkNativeBoolean>,
+    CreateArkValue<NATIVE_NULL>,
+    CreateArkValue<NATIVE_UNDEFINED>,
+    CreateArkValue<NATIVE_SYMBOL>,
+    CreateArkWrapper<ArkNativeBigInt>,
+    CreateArkWrapper<ArkNativeArray>,
+    CreateArkWrapper<ArkNativeFunction>,
+    CreateArkWrapper<ArkNativeArrayBuffer>,
+    CreateArkWrapper<ArkNativeDataView>,
+    CreateArkWrapper<ArkNativeTypedArray>,
+    CreateArkWrapper<ArkNativeExternal>,
+    CreateArkWrapper<ArkNativeDate>,
+    CreateArkObject,
+};
+static_assert(sizeof(ARK_VALUE_FACTORIES) / sizeof(ARK_VALUE_FACTORIES[0]) ==
+    static_cast<size_t>(ArkValueKind::UNKNOWN), "every ArkValueKind needs a factory");
+} // namespace
+
 ArkNativeEngine::ArkNativeEngine(EcmaVM* vm, void* jsEngine) : NativeEngine(jsEngine), vm_(vm), topScope_(vm)
 {
     Local<StringRef> requireName = StringRef::NewFromUtf8(vm, "requireNapi");
@@ -271,13 +374,13 @@ NativeValue* ArkNativeEngine::GetGlobal()
 NativeValue* ArkNativeEngine::CreateNull()
 {
     Local<PrimitiveRef> value = JSValueRef::Null(vm_);
-    return new ArkNativeValue(this, value);
+    return new ArkNativeValue(this, value, NATIVE_NULL);
 }
 
 NativeValue* ArkNativeEngine::CreateUndefined()
 {
     Local<PrimitiveRef> value = JSValueRef::Undefined(vm_);
-    return new ArkNativeValue(this, value);
+    return new ArkNativeValue(this, value, NATIVE_UNDEFINED);
 }
 
 NativeValue* ArkNativeEngine::CreateBoolean(bool value)
@@ -322,7 +425,14 @@ NativeValue* ArkNativeEngine::CreateString(const char* value, size_t length)
 
 NativeValue* ArkNativeEngine::CreateString16(const char16_t* value, size_t length)
 {
-    return nullptr;
+    std::string str(Unicode::Utf16ToUtf8Length(value, length), '\0');
+    size_t strLength = Unicode::Utf16ToUtf8(value, length, &str[0], str.size());
+    return new ArkNativeString(this, str.c_str(), strLength);
+}
+
+NativePropertyKey* ArkNativeEngine::CreatePropertyKey(const char* name, size_t length)
+{
+    return new ArkNativePropertyKey(this, name, length);
 }
 
 NativeValue* ArkNativeEngine::CreateSymbol(NativeValue* value)
@@ -330,7 +440,7 @@ NativeValue* ArkNativeEngine::CreateSymbol(NativeValue* value)
     LocalScope scope(vm_);
     Global<StringRef> str = *value;
     Local<SymbolRef> symbol = SymbolRef::New(vm_, str.ToLocal(vm_));
-    return new ArkNativeValue(this, symbol);
+    return new ArkNativeValue(this, symbol, NATIVE_SYMBOL);
 }
 
 NativeValue* ArkNativeEngine::CreateExternal(void* value, NativeFinalize callback, void* hint)
@@ -343,6 +453,43 @@ NativeValue* ArkNativeEngine::CreateObject()
     return new ArkNativeObject(this);
 }
 
+NativeValue* ArkNativeEngine::CreateObjectWithProperties(
+    NativeValue* prototype, const char* const* names, NativeValue* const* values, size_t count)
+{
+    LocalScope scope(vm_);
+    Local<ObjectRef> object = ObjectRef::New(vm_);
+    if (prototype != nullptr) {
+        Global<ObjectRef> proto = *prototype;
+        if (!object->SetPrototype(vm_, proto.ToLocal(vm_))) {
+            return nullptr;
+        }
+    }
+    for (size_t i = 0; i < count; i++) {
+        Global<JSValueRef> value = *values[i];
+        PropertyAttribute attr(value.ToLocal(vm_), true, true, true);
+        if (!object->DefineProperty(vm_, StringRef::NewFromUtf8(vm_, names[i]), attr)) {
+            return nullptr;
+        }
+    }
+    return new ArkNativeObject(this, object);
+}
+
+NativeValue* ArkNativeEngine::CreateObjectFromTemplate(NativeObjectTemplate* objectTemplate, NativeValue* const* values)
+{
+    LocalScope scope(vm_);
+    Local<ObjectRef> object = ObjectRef::New(vm_);
+    size_t count = objectTemplate->GetPropertyCount();
+    for (size_t i = 0; i < count; i++) {
+        auto key = static_cast<ArkNativePropertyKey*>(objectTemplate->GetPropertyKey(i));
+        Global<JSValueRef> value = *values[i];
+        PropertyAttribute attr(value.ToLocal(vm_), true, true, true);
+        if (!object->DefineProperty(vm_, key->GetKey(vm_), attr)) {
+            return nullptr;
+        }
+    }
+    return new ArkNativeObject(this, object);
+}
+
 NativeValue* ArkNativeEngine::CreateFunction(const char* name, size_t length, NativeCallback cb, void* value)
 {
     return new ArkNativeFunction(this, name, length, cb, value);
@@ -353,6 +500,121 @@ NativeValue* ArkNativeEngine::CreateArray(size_t length)
     return new ArkNativeArray(this, length);
 }
 
+bool ArkNativeEngine::GetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue** result)
+{
+    LocalScope scope(vm_);
+    Global<JSValueRef> value = *array;
+    Local<JSValueRef> obj = value.ToLocal(vm_);
+    for (uint32_t i = 0; i < count; i++) {
+        result[i] = ArkValueToNativeValue(this, ArrayRef::GetValueAt(vm_, obj, start + i));
+    }
+    return true;
+}
+
+bool ArkNativeEngine::SetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue* const* values)
+{
+    LocalScope scope(vm_);
+    Global<JSValueRef> value = *array;
+    Local<JSValueRef> obj = value.ToLocal(vm_);
+    for (uint32_t i = 0; i < count; i++) {
+        Global<JSValueRef> element = *values[i];
+        if (!ArrayRef::SetValueAt(vm_, obj, start + i, element.ToLocal(vm_))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ArkNativeEngine::GetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, double* result)
+{
+    LocalScope scope(vm_);
+    Global<JSValueRef> value = *array;
+    Local<JSValueRef> obj = value.ToLocal(vm_);
+    for (uint32_t i = 0; i < count; i++) {
+        Local<JSValueRef> element = ArrayRef::GetValueAt(vm_, obj, start + i);
+        if (!element->IsNumber()) {
+            return false;
+        }
+        result[i] = Local<NumberRef>(element)->Value();
+    }
+    return true;
+}
+
+bool ArkNativeEngine::GetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, int32_t* result)
+{
+    LocalScope scope(vm_);
+    Global<JSValueRef> value = *array;
+    Local<JSValueRef> obj = value.ToLocal(vm_);
+    for (uint32_t i = 0; i < count; i++) {
+        Local<JSValueRef> element = ArrayRef::GetValueAt(vm_, obj, start + i);
+        if (!element->IsNumber()) {
+            return false;
+        }
+        result[i] = element->Int32Value(vm_);
+    }
+    return true;
+}
+
+bool ArkNativeEngine::GetElementsUtf8(
+    NativeValue* array, uint32_t start, uint32_t count, const char** result, size_t* lengths)
+{
+    LocalScope scope(vm_);
+    Global<JSValueRef> value = *array;
+    Local<JSValueRef> obj = value.ToLocal(vm_);
+    std::vector<Local<StringRef>> strings;
+    strings.reserve(count);
+    size_t size = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        Local<JSValueRef> element = ArrayRef::GetValueAt(vm_, obj, start + i);
+        if (!element->IsString()) {
+            return false;
+        }
+        strings.emplace_back(element);
+        // Utf8Length counts the terminating '\0'
+        size += static_cast<size_t>(strings.back()->Utf8Length());
+    }
+
+    // one scope allocation holds every string so callers don't have to release anything
+    auto buffer = static_cast<char*>(GetScopeManager()->Allocate(size));
+    if (buffer == nullptr) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        int bufferSize = strings[i]->Utf8Length();
+        lengths[i] = static_cast<size_t>(strings[i]->WriteUtf8(buffer, bufferSize) - 1);
+        buffer[lengths[i]] = '\0';
+        result[i] = buffer;
+        buffer += bufferSize;
+    }
+    return true;
+}
+
+bool ArkNativeEngine::SetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, const double* values)
+{
+    LocalScope scope(vm_);
+    Global<JSValueRef> value = *array;
+    Local<JSValueRef> obj = value.ToLocal(vm_);
+    for (uint32_t i = 0; i < count; i++) {
+        if (!ArrayRef::SetValueAt(vm_, obj, start + i, NumberRef::New(vm_, values[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ArkNativeEngine::SetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, const int32_t* values)
+{
+    LocalScope scope(vm_);
+    Global<JSValueRef> value = *array;
+    Local<JSValueRef> obj = value.ToLocal(vm_);
+    for (uint32_t i = 0; i < count; i++) {
+        if (!ArrayRef::SetValueAt(vm_, obj, start + i, IntegerRef::New(vm_, values[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
 NativeValue* ArkNativeEngine::CreateArrayBuffer(void** value, size_t length)
 {
     return new ArkNativeArrayBuffer(this, (uint8_t**)value, length);
@@ -424,7 +686,7 @@ NativeValue* ArkNativeEngine::CreatePromise(NativeDeferred** deferred)
     Local<PromiseCapabilityRef> capability = PromiseCapabilityRef::New(vm_);
     *deferred = new ArkNativeDeferred(this, capability);
 
-    return new ArkNativeValue(this, capability->GetPromise(vm_));
+    return new ArkNativeValue(this, capability->GetPromise(vm_), NATIVE_OBJECT);
 }
 
 NativeValue* ArkNativeEngine::CreateError(NativeValue* code, NativeValue* message)
@@ -459,18 +721,21 @@ NativeValue* ArkNativeEngine::CallFunction(NativeValue* thisVar,
     auto arkNativeFunc = static_cast<ArkNativeFunction*>(nativeFunction);
     OHOS::Ace::ContainerScope containerScope(arkNativeFunc->GetScopeId());
 #endif
-    std::vector<Local<JSValueRef>> args;
-    args.reserve(argc);
+    NativeArgumentBuffer<Local<JSValueRef>> args(argc);
+    if (args.Data() == nullptr) {
+        HILOG_ERROR("allocate arguments failed");
+        return nullptr;
+    }
     for (size_t i = 0; i < argc; i++) {
         if (argv[i] != nullptr) {
             Global<JSValueRef> arg = *argv[i];
-            args.emplace_back(arg.ToLocal(vm_));
+            args[i] = arg.ToLocal(vm_);
         } else {
-            args.emplace_back(JSValueRef::Undefined(vm_));
+            args[i] = JSValueRef::Undefined(vm_);
         }
     }
 
-    Local<JSValueRef> value = funcObj->Call(vm_, thisObj.ToLocal(vm_), args.data(), argc);
+    Local<JSValueRef> value = funcObj->Call(vm_, thisObj.ToLocal(vm_), args.Data(), argc);
     Local<ObjectRef> excep = panda::JSNApi::GetUncaughtException(vm_);
     HandleUncaughtException();
     if (!excep.IsNull()) {
@@ -529,17 +794,20 @@ NativeValue* ArkNativeEngine::CreateInstance(NativeValue* constructor, NativeVal
     LocalScope scope(vm_);
     Global<FunctionRef> value = *constructor;
 
-    std::vector<Local<JSValueRef>> args;
-    args.reserve(argc);
+    NativeArgumentBuffer<Local<JSValueRef>> args(argc);
+    if (args.Data() == nullptr) {
+        HILOG_ERROR("allocate arguments failed");
+        return nullptr;
+    }
     for (size_t i = 0; i < argc; i++) {
         if (argv[i] != nullptr) {
             Global<JSValueRef> arg = *argv[i];
-            args.emplace_back(arg.ToLocal(vm_));
+            args[i] = arg.ToLocal(vm_);
         } else {
-            args.emplace_back(JSValueRef::Undefined(vm_));
+            args[i] = JSValueRef::Undefined(vm_);
         }
     }
-    Local<JSValueRef> instance = value->Constructor(vm_, args.data(), argc);
+    Local<JSValueRef> instance = value->Constructor(vm_, args.Data(), argc);
     return ArkValueToNativeValue(this, instance);
 }
 
@@ -800,35 +1068,11 @@ NativeValue* ArkNativeEngine::LoadModule(NativeValue* str, const std::string& fi
 
 NativeValue* ArkNativeEngine::ArkValueToNativeValue(ArkNativeEngine* engine, Local<JSValueRef> value)
 {
-    NativeValue* result = nullptr;
-    if (value->IsNull() || value->IsUndefined() || value->IsSymbol()) {
-        result = new ArkNativeValue(engine, value);
-    } else if (value->IsNumber()) {
-        result = new ArkNativeNumber(engine, value);
-    } else if (value->IsString()) {
-        result = new ArkNativeString(engine, value);
-    } else if (value->IsArray(engine->GetEcmaVm())) {
-        result = new ArkNativeArray(engine, value);
-    } else if (value->IsFunction()) {
-        result = new ArkNativeFunction(engine, value);
-    } else if (value->IsArrayBuffer()) {
-        result = new ArkNativeArrayBuffer(engine, value);
-    } else if (value->IsDataView()) {
-        result = new ArkNativeDataView(engine, value);
-    } else if (value->IsTypedArray()) {
-        result = new ArkNativeTypedArray(engine, value);
-    } else if (value->IsNativePointer()) {
-        result = new ArkNativeExternal(engine, value);
-    } else if (value->IsDate()) {
-        result = new ArkNativeDate(engine, value);
-    } else if (value->IsBigInt()) {
-        result = new ArkNativeBigInt(engine, value);
-    } else if (value->IsObject() || value->IsPromise()) {
-        result = new ArkNativeObject(engine, value);
-    } else if (value->IsBoolean()) {
-        result = new ArkNativeBoolean(engine, value);
+    ArkValueKind kind = GetArkValueKind(engine->GetEcmaVm(), value);
+    if (kind == ArkValueKind::UNKNOWN) {
+        return nullptr;
     }
-    return result;
+    return ARK_VALUE_FACTORIES[static_cast<size_t>(kind)](engine, value);
 }
 
 NativeValue* ArkNativeEngine::ValueToNativeValue(JSValueWrapper& value)
@@ -94,16 +94,28 @@ public:
     NativeValue* CreateString(const char* value, size_t length) override;
     // Create native string value by const char16_t pointer
     NativeValue* CreateString16(const char16_t* value, size_t length) override;
+    NativePropertyKey* CreatePropertyKey(const char* name, size_t length) override;
     // Create native symbol value
     NativeValue* CreateSymbol(NativeValue* value) override;
     // Create native value of external pointer
     NativeValue* CreateExternal(void* value, NativeFinalize callback, void* hint) override;
     // Create native object value
     NativeValue* CreateObject() override;
+    NativeValue* CreateObjectWithProperties(
+        NativeValue* prototype, const char* const* names, NativeValue* const* values, size_t count) override;
+    NativeValue* CreateObjectFromTemplate(NativeObjectTemplate* objectTemplate, NativeValue* const* values) override;
     // Create native function value
     NativeValue* CreateFunction(const char* name, size_t length, NativeCallback cb, void* value) override;
     // Create native array value
     NativeValue* CreateArray(size_t length) override;
+    bool GetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue** result) override;
+    bool SetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue* const* values) override;
+    bool GetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, double* result) override;
+    bool GetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, int32_t* result) override;
+    bool GetElementsUtf8(
+        NativeValue* array, uint32_t start, uint32_t count, const char** result, size_t* lengths) override;
+    bool SetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, const double* values) override;
+    bool SetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, const int32_t* values) override;
     // Create native array buffer value
     NativeValue* CreateArrayBuffer(void** value, size_t length) override;
     // Create native array buffer value of external
@@ -163,6 +175,17 @@ public:
 
     static NativeValue* ArkValueToNativeValue(ArkNativeEngine* engine, Local<JSValueRef> value);
 
+    // While set, new value wrappers keep the handle of the enclosing panda::LocalScope instead of a Global.
+    // Only valid for wrappers whose native scope closes before that LocalScope does.
+    void SetLocalHandleMode(bool enable)
+    {
+        localHandleMode_ = enable;
+    }
+    bool IsLocalHandleMode() const
+    {
+        return localHandleMode_;
+    }
+
     NativeValue* ValueToNativeValue(JSValueWrapper& value) override;
 
     bool ExecuteJsBin(const std::string& fileName);
@@ -213,6 +236,7 @@ private:
     NativeReference* checkCallbackRef_ { nullptr };
     std::unordered_map<NativeModule*, panda::Global<panda::JSValueRef>> loadedModules_;
     UncaughtExceptionCallback uncaughtExceptionCallback_ { nullptr };
+    bool localHandleMode_ { false };
 };
 
 #endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_IMPL_ARK_ARK_NATIVE_ENGINE_H */
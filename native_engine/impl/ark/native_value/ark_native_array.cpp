@@ -17,7 +17,8 @@
 
 using panda::ObjectRef;
 using panda::ArrayRef;
-ArkNativeArray::ArkNativeArray(ArkNativeEngine* engine, Local<JSValueRef> value) : ArkNativeObject(engine, value) {}
+ArkNativeArray::ArkNativeArray(ArkNativeEngine* engine, Local<JSValueRef> value)
+    : ArkNativeObject(engine, value, NATIVE_OBJECT) {}
 
 ArkNativeArray::ArkNativeArray(ArkNativeEngine* engine, uint32_t length)
     : ArkNativeArray(engine, JSValueRef::Undefined(engine->GetEcmaVm()))
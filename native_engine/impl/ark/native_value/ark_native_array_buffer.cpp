@@ -18,7 +18,7 @@
 
 using panda::ArrayBufferRef;
 ArkNativeArrayBuffer::ArkNativeArrayBuffer(ArkNativeEngine* engine, Local<JSValueRef> value)
-    : ArkNativeObject(engine, value)
+    : ArkNativeObject(engine, value, NATIVE_OBJECT)
 {
 }
 
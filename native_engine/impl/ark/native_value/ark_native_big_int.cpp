@@ -16,7 +16,8 @@
 #include "ark_native_big_int.h"
 using panda::BigIntRef;
 
-ArkNativeBigInt::ArkNativeBigInt(ArkNativeEngine* engine, Local<JSValueRef> value) : ArkNativeValue(engine, value)
+ArkNativeBigInt::ArkNativeBigInt(ArkNativeEngine* engine, Local<JSValueRef> value)
+    : ArkNativeValue(engine, value, NATIVE_BIGINT)
 {}
 
 ArkNativeBigInt::ArkNativeBigInt(ArkNativeEngine* engine, int64_t value)
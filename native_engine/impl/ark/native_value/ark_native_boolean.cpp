@@ -16,7 +16,8 @@
 #include "ark_native_boolean.h"
 
 using panda::BooleanRef;
-ArkNativeBoolean::ArkNativeBoolean(ArkNativeEngine* engine, Local<JSValueRef> value) : ArkNativeValue(engine, value) {}
+ArkNativeBoolean::ArkNativeBoolean(ArkNativeEngine* engine, Local<JSValueRef> value)
+    : ArkNativeValue(engine, value, NATIVE_BOOLEAN) {}
 
 ArkNativeBoolean::ArkNativeBoolean(ArkNativeEngine* engine, bool value)
     : ArkNativeBoolean(engine, JSValueRef::Undefined(engine->GetEcmaVm()))
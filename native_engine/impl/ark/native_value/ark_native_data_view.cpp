@@ -18,7 +18,8 @@
 
 using panda::DataViewRef;
 using panda::ArrayBufferRef;
-ArkNativeDataView::ArkNativeDataView(ArkNativeEngine* engine, Local<JSValueRef> value) : ArkNativeObject(engine, value)
+ArkNativeDataView::ArkNativeDataView(ArkNativeEngine* engine, Local<JSValueRef> value)
+    : ArkNativeObject(engine, value, NATIVE_OBJECT)
 {
 }
 
@@ -18,7 +18,7 @@
 using panda::DateRef;
 
 ArkNativeDate::ArkNativeDate(ArkNativeEngine* engine, Local<JSValueRef> value)
-    : ArkNativeObject(engine, value) {}
+    : ArkNativeObject(engine, value, NATIVE_OBJECT) {}
 
 ArkNativeDate::~ArkNativeDate() {}
 
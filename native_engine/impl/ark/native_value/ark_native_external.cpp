@@ -40,7 +40,7 @@ ArkNativeExternal::ArkNativeExternal(ArkNativeEngine* engine, void* value, Nativ
 }
 
 ArkNativeExternal::ArkNativeExternal(ArkNativeEngine* engine, Local<JSValueRef> value)
-    : ArkNativeValue(engine, value) {}
+    : ArkNativeValue(engine, value, NATIVE_EXTERNAL) {}
 
 ArkNativeExternal::~ArkNativeExternal()
 {
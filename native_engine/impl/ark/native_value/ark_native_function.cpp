@@ -19,6 +19,7 @@
 #include "core/common/container_scope.h"
 #endif
 
+#include "native_engine/native_argument_buffer.h"
 #include "utils/log.h"
 
 using panda::ArrayRef;
@@ -26,7 +27,8 @@ using panda::NativePointerRef;
 using panda::FunctionRef;
 using panda::StringRef;
 using panda::JsiRuntimeCallInfo;
-ArkNativeFunction::ArkNativeFunction(ArkNativeEngine* engine, Local<JSValueRef> value) : ArkNativeObject(engine, value)
+ArkNativeFunction::ArkNativeFunction(ArkNativeEngine* engine, Local<JSValueRef> value)
+    : ArkNativeObject(engine, value, NATIVE_FUNCTION)
 {
 #ifdef ENABLE_CONTAINER_SCOPE
     scopeId_ = OHOS::Ace::ContainerScope::CurrentId();
@@ -132,28 +134,26 @@ Local<JSValueRef> ArkNativeFunction::NativeFunctionCallBack(JsiRuntimeCallInfo *
         return JSValueRef::Undefined(vm);
     }
     NativeScope* nativeScope = scopeManager->Open();
-    cbInfo.thisVar = ArkNativeEngine::ArkValueToNativeValue(engine, runtimeInfo->GetThisRef());
-    cbInfo.function = ArkNativeEngine::ArkValueToNativeValue(engine, runtimeInfo->GetNewTargetRef());
-    cbInfo.argc = runtimeInfo->GetArgsNumber();
-    cbInfo.argv = nullptr;
-    cbInfo.functionInfo = info;
-    if (cbInfo.argc > 0) {
-        cbInfo.argv = new NativeValue* [cbInfo.argc];
-        for (size_t i = 0; i < cbInfo.argc; i++) {
-            cbInfo.argv[i] = ArkNativeEngine::ArkValueToNativeValue(engine, runtimeInfo->GetCallArgRef(i));
-        }
+    size_t argc = runtimeInfo->GetArgsNumber();
+    NativeArgumentBuffer<NativeValue*> nativeArgv(argc);
+    if (nativeArgv.Data() == nullptr) {
+        scopeManager->Close(nativeScope);
+        Local<JSValueRef> error = panda::Exception::Error(vm, StringRef::NewFromUtf8(vm, "allocate arguments failed"));
+        panda::JSNApi::ThrowException(vm, error);
+        return scope.Escape(JSValueRef::Undefined(vm));
     }
+    cbInfo.argc = argc;
+    cbInfo.argv = nativeArgv.Data();
+    cbInfo.functionInfo = info;
+    cbInfo.wrapper = WrapCallbackValue;
+    cbInfo.rawInfo = runtimeInfo;
+    cbInfo.scope = nativeScope;
 
     NativeValue* result = nullptr;
     if (cb != nullptr) {
         result = cb(engine, &cbInfo);
     }
 
-    if (cbInfo.argv != nullptr) {
-        delete[] cbInfo.argv;
-        cbInfo.argv = nullptr;
-    }
-
     Global<JSValueRef> ret(vm, JSValueRef::Undefined(vm));
     if (result == nullptr) {
         if (engine->IsExceptionPending()) {
@@ -170,6 +170,26 @@ Local<JSValueRef> ArkNativeFunction::NativeFunctionCallBack(JsiRuntimeCallInfo *
     return scope.Escape(localRet);
 }
 
+NativeValue* ArkNativeFunction::WrapCallbackValue(NativeCallbackInfo* info, size_t index)
+{
+    auto runtimeInfo = reinterpret_cast<JsiRuntimeCallInfo*>(info->rawInfo);
+    auto engine = reinterpret_cast<ArkNativeEngine*>(info->functionInfo->engine);
+    Local<JSValueRef> value;
+    if (index == NativeCallbackInfo::THIS_INDEX) {
+        value = runtimeInfo->GetThisRef();
+    } else if (index == NativeCallbackInfo::NEW_TARGET_INDEX) {
+        value = runtimeInfo->GetNewTargetRef();
+    } else {
+        value = runtimeInfo->GetCallArgRef(index);
+    }
+    // The call's native scope closes before the EscapeLocalScope of NativeFunctionCallBack,
+    // so the wrapper can borrow the handle instead of creating a Global
+    engine->SetLocalHandleMode(true);
+    NativeValue* result = ArkNativeEngine::ArkValueToNativeValue(engine, value);
+    engine->SetLocalHandleMode(false);
+    return result;
+}
+
 NativeValue* ArkNativeFunction::GetFunctionPrototype()
 {
     auto vm = engine_->GetEcmaVm();
@@ -38,6 +38,7 @@ public:
 
 private:
     static Local<JSValueRef> NativeFunctionCallBack(panda::JsiRuntimeCallInfo *info);
+    static NativeValue* WrapCallbackValue(NativeCallbackInfo* info, size_t index);
 #ifdef ENABLE_CONTAINER_SCOPE
     int32_t scopeId_ = -1;
 #endif
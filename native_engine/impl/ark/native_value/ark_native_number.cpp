@@ -18,7 +18,8 @@
 #include <math.h>
 
 using panda::NumberRef;
-ArkNativeNumber::ArkNativeNumber(ArkNativeEngine* engine, Local<JSValueRef> value) : ArkNativeValue(engine, value) {}
+ArkNativeNumber::ArkNativeNumber(ArkNativeEngine* engine, Local<JSValueRef> value)
+    : ArkNativeValue(engine, value, NATIVE_NUMBER) {}
 
 ArkNativeNumber::ArkNativeNumber(ArkNativeEngine* engine, int32_t value)
     : ArkNativeNumber(engine, JSValueRef::Undefined(engine->GetEcmaVm()))
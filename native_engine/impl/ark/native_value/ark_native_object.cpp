@@ -29,8 +29,21 @@ using panda::StringRef;
 using panda::NativePointerRef;
 using panda::ArrayRef;
 using panda::PropertyAttribute;
+ArkNativePropertyKey::ArkNativePropertyKey(ArkNativeEngine* engine, const char* name, size_t length)
+    : NativePropertyKey(name, length)
+{
+    auto vm = engine->GetEcmaVm();
+    LocalScope scope(vm);
+    key_ = Global<StringRef>(vm, StringRef::NewFromUtf8(vm, name, length));
+}
+
+ArkNativePropertyKey::~ArkNativePropertyKey()
+{
+    key_.FreeGlobalHandleAddr();
+}
+
 ArkNativeObject::ArkNativeObject(ArkNativeEngine* engine)
-    : ArkNativeObject(engine, JSValueRef::Undefined(engine->GetEcmaVm()))
+    : ArkNativeObject(engine, JSValueRef::Undefined(engine->GetEcmaVm()), NATIVE_OBJECT)
 {
     auto vm = engine->GetEcmaVm();
     LocalScope scope(vm);
@@ -40,6 +53,9 @@ ArkNativeObject::ArkNativeObject(ArkNativeEngine* engine)
 
 ArkNativeObject::ArkNativeObject(ArkNativeEngine* engine, Local<JSValueRef> value) : ArkNativeValue(engine, value) {}
 
+ArkNativeObject::ArkNativeObject(ArkNativeEngine* engine, Local<JSValueRef> value, NativeValueType type)
+    : ArkNativeValue(engine, value, type) {}
+
 ArkNativeObject::~ArkNativeObject() {}
 
 void* ArkNativeObject::GetInterface(int interfaceId)
@@ -244,6 +260,27 @@ bool ArkNativeObject::DeleteProperty(const char* name)
     return obj->Delete(vm, key);
 }
 
+bool ArkNativeObject::SetProperty(NativePropertyKey* key, NativeValue* value)
+{
+    auto vm = engine_->GetEcmaVm();
+    LocalScope scope(vm);
+
+    Global<ObjectRef> obj = value_;
+    Global<JSValueRef> val = *value;
+
+    return obj->Set(vm, static_cast<ArkNativePropertyKey*>(key)->GetKey(vm), val.ToLocal(vm));
+}
+
+NativeValue* ArkNativeObject::GetProperty(NativePropertyKey* key)
+{
+    auto vm = engine_->GetEcmaVm();
+    LocalScope scope(vm);
+
+    Global<ObjectRef> obj = value_;
+    Local<JSValueRef> val = obj->Get(vm, static_cast<ArkNativePropertyKey*>(key)->GetKey(vm));
+    return ArkNativeEngine::ArkValueToNativeValue(engine_, val);
+}
+
 bool ArkNativeObject::SetPrivateProperty(const char* name, NativeValue* value)
 {
     return false;
@@ -18,10 +18,25 @@
 
 #include "ark_native_value.h"
 
+class ArkNativePropertyKey : public NativePropertyKey {
+public:
+    ArkNativePropertyKey(ArkNativeEngine* engine, const char* name, size_t length);
+    ~ArkNativePropertyKey() override;
+
+    Local<panda::StringRef> GetKey(const EcmaVM* vm) const
+    {
+        return key_.ToLocal(vm);
+    }
+
+private:
+    Global<panda::StringRef> key_;
+};
+
 class ArkNativeObject : public ArkNativeValue, public NativeObject {
 public:
     explicit ArkNativeObject(ArkNativeEngine* engine);
     ArkNativeObject(ArkNativeEngine* engine, Local<JSValueRef> value);
+    ArkNativeObject(ArkNativeEngine* engine, Local<JSValueRef> value, NativeValueType type);
     ~ArkNativeObject() override;
 
     void* GetInterface(int interfaceId) override;
@@ -47,6 +62,9 @@ public:
     bool HasProperty(const char* name) override;
     bool DeleteProperty(const char* name) override;
 
+    bool SetProperty(NativePropertyKey* key, NativeValue* value) override;
+    NativeValue* GetProperty(NativePropertyKey* key) override;
+
     bool SetPrivateProperty(const char* name, NativeValue* value) override;
     NativeValue* GetPrivateProperty(const char* name) override;
     bool HasPrivateProperty(const char* name) override;
@@ -14,8 +14,12 @@
  */
 
 #include "ark_native_string.h"
+
+#include <vector>
+
 #include "securec.h"
 #include "utils/log.h"
+#include "utils/unicode.h"
 
 using panda::StringRef;
 using panda::ObjectRef;
@@ -27,7 +31,8 @@ ArkNativeString::ArkNativeString(ArkNativeEngine* engine, const char* value, siz
     Local<StringRef> object = StringRef::NewFromUtf8(vm, value, length);
     value_ = Global<StringRef>(vm, object);
 }
-ArkNativeString::ArkNativeString(ArkNativeEngine* engine, Local<JSValueRef> value) : ArkNativeValue(engine, value) {}
+ArkNativeString::ArkNativeString(ArkNativeEngine* engine, Local<JSValueRef> value)
+    : ArkNativeValue(engine, value, NATIVE_STRING) {}
 
 ArkNativeString::~ArkNativeString() {}
 
@@ -55,7 +60,22 @@ void ArkNativeString::GetCString(char* buffer, size_t size, size_t* length)
     }
 }
 
-void ArkNativeString::GetCString16(char16_t* buffer, size_t size, size_t* length) {}
+void ArkNativeString::GetCString16(char16_t* buffer, size_t size, size_t* length)
+{
+    if (length == nullptr) {
+        return;
+    }
+    auto vm = engine_->GetEcmaVm();
+    LocalScope scope(vm);
+    Global<StringRef> val = value_;
+    std::vector<char> str(val->Utf8Length());
+    size_t strLength = static_cast<size_t>(val->WriteUtf8(str.data(), str.size()) - 1);
+    *length = Unicode::Utf8ToUtf16Length(str.data(), strLength);
+    if (buffer != nullptr && size > 0) {
+        size_t copied = Unicode::Utf8ToUtf16(str.data(), strLength, buffer, size - 1);
+        buffer[copied] = u'\0';
+    }
+}
 
 size_t ArkNativeString::GetLength()
 {
@@ -16,7 +16,7 @@
 #include "ark_native_typed_array.h"
 
 ArkNativeTypedArray::ArkNativeTypedArray(ArkNativeEngine* engine, Local<JSValueRef> value)
-    : ArkNativeObject(engine, value)
+    : ArkNativeObject(engine, value, NATIVE_OBJECT)
 {
 }
 
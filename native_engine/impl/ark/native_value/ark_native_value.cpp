@@ -16,10 +16,21 @@
 #include "ark_native_value.h"
 
 ArkNativeValue::ArkNativeValue(ArkNativeEngine* engine, Local<JSValueRef> value)
+    : ArkNativeValue(engine, value, GetValueType(value))
+{
+}
+
+ArkNativeValue::ArkNativeValue(ArkNativeEngine* engine, Local<JSValueRef> value, NativeValueType type)
 {
     engine_ = engine;
-    Global<JSValueRef> globalValue(engine->GetEcmaVm(), value);
-    value_ = globalValue;
+    type_ = type;
+    if (engine->IsLocalHandleMode()) {
+        value_ = value;
+        isLocal_ = true;
+    } else {
+        Global<JSValueRef> globalValue(engine->GetEcmaVm(), value);
+        value_ = globalValue;
+    }
 
     NativeScopeManager* scopeManager = engine_->GetScopeManager();
     if (scopeManager != nullptr) {
@@ -30,8 +41,10 @@ ArkNativeValue::ArkNativeValue(ArkNativeEngine* engine, Local<JSValueRef> value)
 ArkNativeValue::~ArkNativeValue()
 {
     // Addr of Global stored in ArkNativeValue should be released.
-    Global<JSValueRef> oldValue = value_;
-    oldValue.FreeGlobalHandleAddr();
+    if (!isLocal_) {
+        Global<JSValueRef> oldValue = value_;
+        oldValue.FreeGlobalHandleAddr();
+    }
 }
 
 void* ArkNativeValue::GetInterface(int interfaceId)
@@ -42,43 +55,20 @@ void* ArkNativeValue::GetInterface(int interfaceId)
 void ArkNativeValue::UpdateValue(Local<JSValueRef> value)
 {
     auto vm = engine_->GetEcmaVm();
-    Global<JSValueRef> oldValue = value_;
-    oldValue.FreeGlobalHandleAddr();
+    if (!isLocal_) {
+        Global<JSValueRef> oldValue = value_;
+        oldValue.FreeGlobalHandleAddr();
+    }
 
     Global<JSValueRef> newValue(vm, value);
     value_ = newValue;
+    isLocal_ = false;
+    type_ = GetValueType(value);
 }
 
 NativeValueType ArkNativeValue::TypeOf()
 {
-    Global<JSValueRef> value = value_;
-    NativeValueType result;
-
-    if (value->IsNumber()) {
-        result = NATIVE_NUMBER;
-    } else if (value->IsString()) {
-        result = NATIVE_STRING;
-    } else if (value->IsFunction()) {
-        result = NATIVE_FUNCTION;
-    } else if (value->IsNativePointer()) {
-        result = NATIVE_EXTERNAL;
-    } else if (value->IsNull()) {
-        result = NATIVE_NULL;
-    } else if (value->IsBoolean()) {
-        result = NATIVE_BOOLEAN;
-    } else if (value->IsUndefined()) {
-        result = NATIVE_UNDEFINED;
-    } else if (value->IsSymbol()) {
-        result = NATIVE_SYMBOL;
-    } else if (value->IsBigInt()) {
-        result = NATIVE_BIGINT;
-    } else if (value->IsObject()) {
-        result = NATIVE_OBJECT;
-    } else {
-        result = NATIVE_UNDEFINED;
-    }
-
-    return result;
+    return type_;
 }
 
 bool ArkNativeValue::InstanceOf(NativeValue* obj)
@@ -284,3 +274,34 @@ bool ArkNativeValue::StrictEquals(NativeValue* value)
     Global<JSValueRef> value2 = *value;
     return value1->IsStrictEquals(vm, value2.ToLocal(vm));
 }
+
+NativeValueType ArkNativeValue::GetValueType(Local<JSValueRef> value)
+{
+    NativeValueType result;
+
+    if (value->IsNumber()) {
+        result = NATIVE_NUMBER;
+    } else if (value->IsString()) {
+        result = NATIVE_STRING;
+    } else if (value->IsFunction()) {
+        result = NATIVE_FUNCTION;
+    } else if (value->IsNativePointer()) {
+        result = NATIVE_EXTERNAL;
+    } else if (value->IsNull()) {
+        result = NATIVE_NULL;
+    } else if (value->IsBoolean()) {
+        result = NATIVE_BOOLEAN;
+    } else if (value->IsUndefined()) {
+        result = NATIVE_UNDEFINED;
+    } else if (value->IsSymbol()) {
+        result = NATIVE_SYMBOL;
+    } else if (value->IsBigInt()) {
+        result = NATIVE_BIGINT;
+    } else if (value->IsObject()) {
+        result = NATIVE_OBJECT;
+    } else {
+        result = NATIVE_UNDEFINED;
+    }
+
+    return result;
+}
@@ -25,6 +25,7 @@ using panda::JSValueRef;
 class ArkNativeValue : public NativeValue {
 public:
     ArkNativeValue(ArkNativeEngine* engine, Local<JSValueRef> value);
+    ArkNativeValue(ArkNativeEngine* engine, Local<JSValueRef> value, NativeValueType type);
     ~ArkNativeValue() override;
 
     void* GetInterface(int interfaceId) override;
@@ -71,8 +72,13 @@ public:
     // If you must replace it, you should use this method.
     void UpdateValue(Local<JSValueRef> value);
 
+    static NativeValueType GetValueType(Local<JSValueRef> value);
+
 protected:
     ArkNativeEngine* engine_;
+    NativeValueType type_;
+    // value_ holds a local handle owned by the enclosing panda::LocalScope rather than a Global
+    bool isLocal_ = false;
 };
 
 #endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_IMPL_ARK_NATIVE_VALUE_ARK_NATIVE_VALUE_H */
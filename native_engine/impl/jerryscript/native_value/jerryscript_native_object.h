@@ -47,6 +47,9 @@ public:
     NativeValue* GetProperty(const char* name) override;
     bool HasProperty(const char* name) override;
     bool DeleteProperty(const char* name) override;
+    // The NativePropertyKey overloads keep their name based default
+    using NativeObject::SetProperty;
+    using NativeObject::GetProperty;
 
     bool SetPrivateProperty(const char* name, NativeValue* value) override;
     NativeValue* GetPrivateProperty(const char* name) override;
@@ -17,7 +17,8 @@
 #include "native_engine/native_engine.h"
 #include "quickjs_headers.h"
 
-QuickJSNativeArray::QuickJSNativeArray(QuickJSNativeEngine* engine, JSValue value) : QuickJSNativeObject(engine, value)
+QuickJSNativeArray::QuickJSNativeArray(QuickJSNativeEngine* engine, JSValue value)
+    : QuickJSNativeObject(engine, value, NATIVE_OBJECT)
 {
 }
 
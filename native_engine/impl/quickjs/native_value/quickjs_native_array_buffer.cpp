@@ -24,7 +24,7 @@ struct QuickJsArrayCallback {
 };
 
 QuickJSNativeArrayBuffer::QuickJSNativeArrayBuffer(QuickJSNativeEngine* engine, JSValue value)
-    : QuickJSNativeObject(engine, value)
+    : QuickJSNativeObject(engine, value, NATIVE_OBJECT)
 {
 }
 
@@ -41,7 +41,7 @@ QuickJSNativeArrayBuffer::QuickJSNativeArrayBuffer(QuickJSNativeEngine* engine,
                                                    size_t length,
                                                    NativeFinalize cb,
                                                    void* hint)
-    : QuickJSNativeObject(engine, JS_NULL)
+    : QuickJSNativeObject(engine, JS_NULL, NATIVE_OBJECT)
 {
     auto cbinfo = QuickJsArrayCallback::CreateNewInstance();
     if (cbinfo != nullptr) {
@@ -15,7 +15,8 @@
 
 #include "quickjs_native_big_int.h"
 
-QuickJSNativeBigInt::QuickJSNativeBigInt(QuickJSNativeEngine* engine, JSValue value) : QuickJSNativeValue(engine, value)
+QuickJSNativeBigInt::QuickJSNativeBigInt(QuickJSNativeEngine* engine, JSValue value)
+    : QuickJSNativeValue(engine, value, NATIVE_BIGINT)
 {}
 
 QuickJSNativeBigInt::QuickJSNativeBigInt(QuickJSNativeEngine* engine, int64_t value)
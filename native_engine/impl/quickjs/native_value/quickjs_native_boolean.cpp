@@ -16,7 +16,7 @@
 #include "quickjs_native_boolean.h"
 
 QuickJSNativeBoolean::QuickJSNativeBoolean(QuickJSNativeEngine* engine, JSValue value)
-    : QuickJSNativeValue(engine, value)
+    : QuickJSNativeValue(engine, value, NATIVE_BOOLEAN)
 {
 }
 
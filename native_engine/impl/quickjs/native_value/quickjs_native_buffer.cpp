@@ -14,6 +14,10 @@
  */
 #include "quickjs_native_buffer.h"
 
+#include "quickjs_buffer_pool.h"
+#include "securec.h"
+#include "utils/log.h"
+
 struct QuickJSBufferCallback {
     static QuickJSBufferCallback* CreateNewInstance()
     {
@@ -25,7 +29,7 @@ struct QuickJSBufferCallback {
 };
 
 QuickJSNativeBuffer::QuickJSNativeBuffer(QuickJSNativeEngine* engine, JSValue value)
-    : QuickJSNativeObject(engine, value)
+    : QuickJSNativeObject(engine, value, NATIVE_OBJECT)
 {
     SetPriviteProperty(engine_->GetContext(), value);
 }
@@ -34,7 +38,7 @@ QuickJSNativeBuffer::QuickJSNativeBuffer(QuickJSNativeEngine* engine, uint8_t**
     : QuickJSNativeBuffer(engine, JS_NULL)
 {
     size_t size = 0;
-    value_ = JS_NewArrayBufferCopy(engine_->GetContext(), nullptr, length);
+    value_ = engine_->GetBufferPool()->NewArrayBuffer(engine_->GetContext(), length);
     SetPriviteProperty(engine_->GetContext(), value_);
     *value = JS_GetArrayBuffer(engine_->GetContext(), &size, value_);
 }
@@ -44,15 +48,18 @@ QuickJSNativeBuffer::QuickJSNativeBuffer(QuickJSNativeEngine* engine, uint8_t**
 {
     size_t size = 0;
     if (data != nullptr) {
-        value_ = JS_NewArrayBufferCopy(engine_->GetContext(), (uint8_t*)data, length);
+        value_ = engine_->GetBufferPool()->NewArrayBuffer(engine_->GetContext(), length);
         SetPriviteProperty(engine_->GetContext(), value_);
         *value = JS_GetArrayBuffer(engine_->GetContext(), &size, value_);
+        if (*value != nullptr && length > 0 && memcpy_s(*value, size, data, length) != EOK) {
+            HILOG_ERROR("memcpy_s failed");
+        }
     }
 }
 
 QuickJSNativeBuffer::QuickJSNativeBuffer(
     QuickJSNativeEngine* engine, uint8_t* data, size_t length, NativeFinalize cb, void* hint)
-    : QuickJSNativeObject(engine, JS_NULL)
+    : QuickJSNativeObject(engine, JS_NULL, NATIVE_OBJECT)
 {
     auto cbinfo = QuickJSBufferCallback::CreateNewInstance();
     if (cbinfo != nullptr) {
@@ -19,7 +19,7 @@
 #include "quickjs_native_array_buffer.h"
 
 QuickJSNativeDataView::QuickJSNativeDataView(QuickJSNativeEngine* engine, JSValue value)
-    : QuickJSNativeObject(engine, value)
+    : QuickJSNativeObject(engine, value, NATIVE_OBJECT)
 {
 }
 
@@ -29,19 +29,16 @@ QuickJSNativeDataView::QuickJSNativeDataView(QuickJSNativeEngine* engine,
                                              size_t offset)
     : QuickJSNativeDataView(engine, JS_NULL)
 {
-    JSValue global = JS_GetGlobalObject(engine_->GetContext());
-    JSValue dataView = JS_GetPropertyStr(engine_->GetContext(), global, "DataView");
-
     JSValue param[] = {
         *value,
         JS_NewInt64(engine_->GetContext(), offset),
         JS_NewInt64(engine_->GetContext(), length),
     };
 
-    value_ = JS_CallConstructor(engine_->GetContext(), dataView, 3, param);
-
-    JS_FreeValue(engine_->GetContext(), dataView);
-    JS_FreeValue(engine_->GetContext(), global);
+    value_ = JS_CallConstructor(engine_->GetContext(), engine_->GetDataViewConstructor(), 3, param);
+    if (JS_IsException(value_)) {
+        type_ = NATIVE_UNDEFINED;
+    }
 }
 
 QuickJSNativeDataView::~QuickJSNativeDataView() {}
@@ -16,7 +16,7 @@
 #include "quickjs_native_date.h"
 
 QuickJSNativeDate::QuickJSNativeDate(QuickJSNativeEngine* engine, JSValue value)
-    : QuickJSNativeObject(engine, value) {}
+    : QuickJSNativeObject(engine, value, NATIVE_OBJECT) {}
 
 QuickJSNativeDate::~QuickJSNativeDate() {}
 
@@ -19,7 +19,7 @@ QuickJSNativeExternal::QuickJSNativeExternal(QuickJSNativeEngine* engine,
                                              void* value,
                                              NativeFinalize callback,
                                              void* hint)
-    : QuickJSNativeValue(engine, JS_UNDEFINED)
+    : QuickJSNativeValue(engine, JS_UNDEFINED, NATIVE_EXTERNAL)
 {
     NativeObjectInfo* info = NativeObjectInfo::CreateNewInstance();
     if (info != nullptr) {
@@ -42,7 +42,7 @@ QuickJSNativeExternal::QuickJSNativeExternal(QuickJSNativeEngine* engine,
 }
 
 QuickJSNativeExternal::QuickJSNativeExternal(QuickJSNativeEngine* engine, JSValue value)
-    : QuickJSNativeValue(engine, value)
+    : QuickJSNativeValue(engine, value, NATIVE_EXTERNAL)
 {
 }
 
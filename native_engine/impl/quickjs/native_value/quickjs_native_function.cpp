@@ -14,6 +14,7 @@
  */
 
 #include "quickjs_native_function.h"
+#include "native_engine/native_argument_buffer.h"
 #include "native_engine/native_value.h"
 #include "quickjs_native_engine.h"
 #include "quickjs_native_number.h"
@@ -22,7 +23,7 @@
 #include "utils/log.h"
 
 QuickJSNativeFunction::QuickJSNativeFunction(QuickJSNativeEngine* engine, JSValue value)
-    : QuickJSNativeObject(engine, value)
+    : QuickJSNativeObject(engine, value, NATIVE_FUNCTION)
 {
 }
 
@@ -30,26 +31,25 @@ QuickJSNativeFunction::QuickJSNativeFunction(QuickJSNativeEngine* engine,
                                              const char* name,
                                              NativeCallback cb,
                                              void* value)
-    : QuickJSNativeObject(engine, JS_UNDEFINED)
+    : QuickJSNativeObject(engine, JS_UNDEFINED, NATIVE_FUNCTION)
 {
     NativeFunctionInfo* info = NativeFunctionInfo::CreateNewInstance();
-    if (info != nullptr) {
-        info->engine = engine;
-        info->callback = cb;
-        info->data = value;
+    if (info == nullptr) {
+        HILOG_ERROR("info is null");
+        return;
     }
-
-    JSValue functionContext = JS_NewExternal(engine_->GetContext(), info,
-                                             [](JSContext* ctx, void* data, void* hint) {
-                                                 auto info = (NativeFunctionInfo*)data;
-                                                 if (info != nullptr) {
-                                                     delete info;
-                                                 }
-                                             },
-                                             nullptr);
-
-    value_ = JS_NewCFunctionData(engine_->GetContext(), JSCFunctionData, 0, 0, 1, &functionContext);
-    JS_DefinePropertyValueStr(engine_->GetContext(), value_, "_functionContext", functionContext, 0);
+    info->engine = engine;
+    info->callback = cb;
+    info->data = value;
+
+    // A single object of the native function class, the class finalizer releases info
+    JSValue function = JS_NewObjectClass(engine_->GetContext(), GetClassID());
+    if (JS_IsException(function)) {
+        delete info;
+        return;
+    }
+    JS_SetOpaque(function, info);
+    value_ = function;
 }
 
 QuickJSNativeFunction::~QuickJSNativeFunction() {}
@@ -60,14 +60,47 @@ void* QuickJSNativeFunction::GetInterface(int interfaceId)
                                                          : QuickJSNativeObject::GetInterface(interfaceId);
 }
 
-JSValue QuickJSNativeFunction::JSCFunctionData(JSContext* ctx,
-                                               JSValueConst thisVal,
-                                               int argc,
-                                               JSValueConst* argv,
-                                               int magic,
-                                               JSValue* funcData)
+JSClassID QuickJSNativeFunction::GetClassID()
+{
+    static JSClassID classId = [] {
+        JSClassID id = 0;
+        JS_NewClassID(&id);
+        return id;
+    }();
+    return classId;
+}
+
+void QuickJSNativeFunction::AddIntrinsicNativeFunction(JSContext* context)
+{
+    const JSClassDef classDef = {
+        .class_name = "NativeFunction",
+        .finalizer =
+            [](JSRuntime* rt, JSValue val) {
+                auto info = (NativeFunctionInfo*)JS_GetOpaque(val, GetClassID());
+                if (info != nullptr) {
+                    delete info;
+                }
+            },
+        .call = Call,
+    };
+    JS_NewClass(JS_GetRuntime(context), GetClassID(), &classDef);
+
+    // Instances inherit call, apply, bind, name and length from Function.prototype
+    JSValue global = JS_GetGlobalObject(context);
+    JSValue functionConstructor = JS_GetPropertyStr(context, global, "Function");
+    JS_SetClassProto(context, GetClassID(), JS_GetPropertyStr(context, functionConstructor, "prototype"));
+    JS_FreeValue(context, functionConstructor);
+    JS_FreeValue(context, global);
+}
+
+JSValue QuickJSNativeFunction::Call(JSContext* ctx,
+                                    JSValueConst funcObj,
+                                    JSValueConst thisVal,
+                                    int argc,
+                                    JSValueConst* argv,
+                                    int flags)
 {
-    auto info = (NativeFunctionInfo*)JS_ExternalToNativeObject(ctx, *funcData);
+    auto info = (NativeFunctionInfo*)JS_GetOpaque(funcObj, GetClassID());
     if (info == nullptr) {
         HILOG_ERROR("info is null");
         return JS_UNDEFINED;
@@ -88,24 +121,22 @@ JSValue QuickJSNativeFunction::JSCFunctionData(JSContext* ctx,
         return JS_UNDEFINED;
     }
     NativeScope* scope = scopeManager->OpenEscape();
-    callbackInfo.thisVar = QuickJSNativeEngine::JSValueToNativeValue(engine, JS_DupValue(ctx, thisVal));
 
+    CallFrame frame = { ctx, thisVal, JS_UNDEFINED, argv };
+    NativeArgumentBuffer<NativeValue*> nativeArgv(argc);
+    if (nativeArgv.Data() == nullptr) {
+        scopeManager->CloseEscape(scope);
+        return JS_ThrowOutOfMemory(ctx);
+    }
     callbackInfo.argc = argc;
-    callbackInfo.argv = nullptr;
+    callbackInfo.argv = nativeArgv.Data();
     callbackInfo.functionInfo = info;
-    if (callbackInfo.argc > 0) {
-        callbackInfo.argv = new NativeValue*[argc];
-        for (int i = 0; i < argc && callbackInfo.argv != nullptr; i++) {
-            callbackInfo.argv[i] = QuickJSNativeEngine::JSValueToNativeValue(engine, JS_DupValue(ctx, argv[i]));
-        }
-    }
+    callbackInfo.wrapper = WrapCallbackValue;
+    callbackInfo.rawInfo = &frame;
+    callbackInfo.scope = scope;
 
     value = info->callback(info->engine, &callbackInfo);
 
-    if (callbackInfo.argv != nullptr) {
-        delete []callbackInfo.argv;
-    }
-
     JSValue result = JS_UNDEFINED;
     if (value != nullptr) {
         result = JS_DupValue(ctx, *value);
@@ -118,3 +149,22 @@ JSValue QuickJSNativeFunction::JSCFunctionData(JSContext* ctx,
     scopeManager->CloseEscape(scope);
     return result;
 }
+
+NativeValue* QuickJSNativeFunction::WrapCallbackValue(NativeCallbackInfo* info, size_t index)
+{
+    auto frame = reinterpret_cast<CallFrame*>(info->rawInfo);
+    auto engine = reinterpret_cast<QuickJSNativeEngine*>(info->functionInfo->engine);
+    JSValueConst value = JS_UNDEFINED;
+    if (index == NativeCallbackInfo::THIS_INDEX) {
+        value = frame->thisVal;
+    } else if (index == NativeCallbackInfo::NEW_TARGET_INDEX) {
+        // plain calls have no new.target
+        if (JS_IsUndefined(frame->newTarget)) {
+            return nullptr;
+        }
+        value = frame->newTarget;
+    } else {
+        value = frame->argv[index];
+    }
+    return QuickJSNativeEngine::JSValueToNativeValue(engine, JS_DupValue(frame->context, value));
+}
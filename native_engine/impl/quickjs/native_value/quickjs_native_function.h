@@ -28,13 +28,26 @@ public:
 
     void* GetInterface(int interfaceId) override;
 
+    // Raw values of an ongoing native call, wrapped on first use through WrapCallbackValue
+    struct CallFrame {
+        JSContext* context;
+        JSValueConst thisVal;
+        JSValueConst newTarget;
+        JSValueConst* argv;
+    };
+    static NativeValue* WrapCallbackValue(NativeCallbackInfo* info, size_t index);
+
+    // Native functions are objects of a callable class holding their NativeFunctionInfo as opaque
+    static JSClassID GetClassID();
+    static void AddIntrinsicNativeFunction(JSContext* context);
+
 private:
-    static JSValue JSCFunctionData(JSContext* ctx,
-                                   JSValueConst thisVal,
-                                   int argc,
-                                   JSValueConst* argv,
-                                   int magic,
-                                   JSValue* funcData);
+    static JSValue Call(JSContext* ctx,
+                        JSValueConst funcObj,
+                        JSValueConst thisVal,
+                        int argc,
+                        JSValueConst* argv,
+                        int flags);
 };
 
 #endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_IMPL_QUICKJS_NATIVE_VALUE_QUICKJS_NATIVE_FUNCTION_H */
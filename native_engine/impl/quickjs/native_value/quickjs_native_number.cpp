@@ -15,7 +15,8 @@
 
 #include "quickjs_native_number.h"
 
-QuickJSNativeNumber::QuickJSNativeNumber(QuickJSNativeEngine* engine, JSValue value) : QuickJSNativeValue(engine, value)
+QuickJSNativeNumber::QuickJSNativeNumber(QuickJSNativeEngine* engine, JSValue value)
+    : QuickJSNativeValue(engine, value, NATIVE_NUMBER)
 {
 }
 
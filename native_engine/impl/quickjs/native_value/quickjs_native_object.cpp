@@ -14,6 +14,9 @@
  */
 
 #include "quickjs_native_object.h"
+
+#include <new>
+
 #include "native_engine/native_engine.h"
 #include "native_engine/native_property.h"
 #include "quickjs_headers.h"
@@ -24,8 +27,18 @@
 #include "quickjs_native_string.h"
 #include "utils/log.h"
 
+QuickJSNativePropertyKey::QuickJSNativePropertyKey(QuickJSNativeEngine* engine, const char* name, size_t length)
+    : NativePropertyKey(name, length), context_(engine->GetContext()), atom_(JS_NewAtomLen(context_, name, length))
+{
+}
+
+QuickJSNativePropertyKey::~QuickJSNativePropertyKey()
+{
+    JS_FreeAtom(context_, atom_);
+}
+
 QuickJSNativeObject::QuickJSNativeObject(QuickJSNativeEngine* engine)
-    : QuickJSNativeObject(engine, JS_NewObject(engine->GetContext()))
+    : QuickJSNativeObject(engine, JS_NewObject(engine->GetContext()), NATIVE_OBJECT)
 {
 }
 
@@ -33,58 +46,47 @@ QuickJSNativeObject::QuickJSNativeObject(QuickJSNativeEngine* engine, JSValue va
 {
 }
 
+QuickJSNativeObject::QuickJSNativeObject(QuickJSNativeEngine* engine, JSValue value, NativeValueType type)
+    : QuickJSNativeValue(engine, value, type)
+{
+}
+
 QuickJSNativeObject::~QuickJSNativeObject() {}
 
 void QuickJSNativeObject::SetNativePointer(void* pointer, NativeFinalize cb, void* hint)
 {
-    NativeObjectInfo* info = (NativeObjectInfo*)JS_GetNativePointer(engine_->GetContext(), value_);
+    NativeObjectInfo* info = JS_GetWrapInfo(value_);
     if (info == nullptr) {
-        info = new NativeObjectInfo();
-        if (info != nullptr) {
-            info->callback = cb;
-            info->engine = engine_;
-            info->nativeObject = pointer;
-            info->hint = hint;
-        }
-        JS_SetNativePointer(
-            engine_->GetContext(), value_, info,
-            [](JSContext* context, void* data, void* hint) {
-                auto info = reinterpret_cast<NativeObjectInfo*>(data);
-                if (info) {
-                    info->callback(info->engine, info->nativeObject, info->hint);
-                    delete info;
-                }
-            },
-            hint);
-    } else if (pointer == nullptr) {
-        JS_SetNativePointer(engine_->GetContext(), value_, nullptr, nullptr, nullptr);
-        delete info;
+        return;
+    }
+    if (pointer == nullptr) {
+        *info = NativeObjectInfo();
+    } else if (info->nativeObject == nullptr) {
+        info->engine = engine_;
+        info->nativeObject = pointer;
+        info->callback = cb;
+        info->hint = hint;
     }
 }
 
 void* QuickJSNativeObject::GetNativePointer()
 {
-    NativeObjectInfo* info = (NativeObjectInfo*)JS_GetNativePointer(engine_->GetContext(), value_);
-    return info ? info->nativeObject : nullptr;
+    NativeObjectInfo* info = JS_GetWrapInfo(value_);
+    return (info != nullptr) ? info->nativeObject : nullptr;
 }
 
 void QuickJSNativeObject::AddFinalizer(void* pointer, NativeFinalize cb, void* hint)
 {
-    NativeObjectInfo* info = (NativeObjectInfo*)JS_GetNativePointer(engine_->GetContext(), value_);
-    if (info == nullptr) {
-        info = new NativeObjectInfo();
-        if (info != nullptr) {
-            info->callback = cb;
-            info->engine = engine_;
-            info->nativeObject = pointer;
-            info->hint = hint;
-        }
-    }
+    NativeObjectInfo* info = new (std::nothrow) NativeObjectInfo();
     if (info == nullptr) {
         return;
     }
+    info->callback = cb;
+    info->engine = engine_;
+    info->nativeObject = pointer;
+    info->hint = hint;
 
-    JS_AddFinalizer(
+    bool added = JS_AddFinalizer(
         engine_->GetContext(), value_, info,
         [](JSContext* context, void* data, void* hint) {
             auto info = reinterpret_cast<NativeObjectInfo*>(data);
@@ -94,6 +96,10 @@ void QuickJSNativeObject::AddFinalizer(void* pointer, NativeFinalize cb, void* h
             }
         },
         hint);
+    if (!added) {
+        HILOG_ERROR("object does not accept a finalizer");
+        delete info;
+    }
 }
 
 void* QuickJSNativeObject::GetInterface(int interfaceId)
@@ -230,6 +236,19 @@ bool QuickJSNativeObject::DeleteProperty(const char* name)
     return result;
 }
 
+bool QuickJSNativeObject::SetProperty(NativePropertyKey* key, NativeValue* value)
+{
+    JSAtom atom = static_cast<QuickJSNativePropertyKey*>(key)->GetAtom();
+    return JS_SetProperty(engine_->GetContext(), value_, atom, JS_DupValue(engine_->GetContext(), *value));
+}
+
+NativeValue* QuickJSNativeObject::GetProperty(NativePropertyKey* key)
+{
+    JSAtom atom = static_cast<QuickJSNativePropertyKey*>(key)->GetAtom();
+    JSValue value = JS_GetProperty(engine_->GetContext(), value_, atom);
+    return QuickJSNativeEngine::JSValueToNativeValue(engine_, value);
+}
+
 bool QuickJSNativeObject::SetPrivateProperty(const char* name, NativeValue* value)
 {
     bool result = false;
@@ -315,6 +334,11 @@ bool QuickJSNativeObject::AssociateTypeTag(NapiTypeTag* typeTag)
     if (typeTag == nullptr) {
         return false;
     }
+    int slotResult = JS_SetTypeTag(engine_->GetContext(), value_, typeTag);
+    if (slotResult >= 0) {
+        return slotResult > 0;
+    }
+    // Plain objects have no native record, the tag is kept in a property instead
     uint64_t words[size] = {typeTag->lower, typeTag->upper};
     hasPribate = HasPrivateProperty(name);
     if (!hasPribate) {
@@ -336,6 +360,10 @@ bool QuickJSNativeObject::CheckTypeTag(NapiTypeTag* typeTag)
     if (typeTag == nullptr) {
         return ret;
     }
+    int slotResult = JS_CheckTypeTag(value_, typeTag);
+    if (slotResult >= 0) {
+        return slotResult > 0;
+    }
     result = HasPrivateProperty(name);
     if (result) {
         JSAtom key = JS_NewAtom(engine_->GetContext(), name);
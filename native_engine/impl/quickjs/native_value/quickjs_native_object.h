@@ -18,10 +18,26 @@
 
 #include "quickjs_native_value.h"
 
+class QuickJSNativePropertyKey : public NativePropertyKey {
+public:
+    QuickJSNativePropertyKey(QuickJSNativeEngine* engine, const char* name, size_t length);
+    ~QuickJSNativePropertyKey() override;
+
+    JSAtom GetAtom() const
+    {
+        return atom_;
+    }
+
+private:
+    JSContext* context_;
+    JSAtom atom_;
+};
+
 class QuickJSNativeObject : public QuickJSNativeValue, public NativeObject {
 public:
     explicit QuickJSNativeObject(QuickJSNativeEngine* engine);
     QuickJSNativeObject(QuickJSNativeEngine* engine, JSValue value);
+    QuickJSNativeObject(QuickJSNativeEngine* engine, JSValue value, NativeValueType type);
     ~QuickJSNativeObject() override;
 
     void* GetInterface(int interfaceId) override;
@@ -47,6 +63,9 @@ public:
     bool HasProperty(const char* name) override;
     bool DeleteProperty(const char* name) override;
 
+    bool SetProperty(NativePropertyKey* key, NativeValue* value) override;
+    NativeValue* GetProperty(NativePropertyKey* key) override;
+
     bool SetPrivateProperty(const char* name, NativeValue* value) override;
     NativeValue* GetPrivateProperty(const char* name) override;
     bool HasPrivateProperty(const char* name) override;
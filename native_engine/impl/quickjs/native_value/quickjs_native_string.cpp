@@ -15,10 +15,25 @@
 
 #include "quickjs_native_string.h"
 
+#include <algorithm>
+
 #include "securec.h"
 #include "utils/log.h"
+#include "utils/unicode.h"
+
+namespace {
+// UTF-8 length of a code point outside the BMP, stored as a surrogate pair in JS
+constexpr size_t UTF8_SURROGATE_PAIR_LENGTH = 4;
+
+inline size_t Utf8CodePointLen(uint8_t ch)
+{
+    constexpr uint8_t offset = 3;
+    return ((0xe5000000 >> ((ch >> offset) & 0x1e)) & offset) + 1;
+}
+} // namespace
 
-QuickJSNativeString::QuickJSNativeString(QuickJSNativeEngine* engine, JSValue value) : QuickJSNativeValue(engine, value)
+QuickJSNativeString::QuickJSNativeString(QuickJSNativeEngine* engine, JSValue value)
+    : QuickJSNativeValue(engine, value, NATIVE_STRING)
 {
 }
 
@@ -38,7 +53,12 @@ QuickJSNativeString::QuickJSNativeString(QuickJSNativeEngine* engine, const char
 {
 }
 
-QuickJSNativeString::~QuickJSNativeString() {}
+QuickJSNativeString::~QuickJSNativeString()
+{
+    if (view_ != nullptr) {
+        JS_FreeCString(engine_->GetContext(), view_);
+    }
+}
 
 void* QuickJSNativeString::GetInterface(int interfaceId)
 {
@@ -47,12 +67,14 @@ void* QuickJSNativeString::GetInterface(int interfaceId)
 
 void QuickJSNativeString::GetCString(char* buffer, size_t size, size_t* length)
 {
-    const char* str = JS_ToCStringLen(engine_->GetContext(), length, value_);
-
+    size_t strLength = 0;
+    const char* str = AcquireCString(&strLength);
     if (str == nullptr) {
-        HILOG_ERROR("JS_ToCStringLen return value is null");
         return;
     }
+    if (length != nullptr) {
+        *length = strLength;
+    }
 
     if (buffer != nullptr && length != nullptr) {
         int ret = strncpy_s(buffer, size, str, *length);
@@ -60,29 +82,60 @@ void QuickJSNativeString::GetCString(char* buffer, size_t size, size_t* length)
             HILOG_ERROR("strncpy_s failed");
         }
     }
-    JS_FreeCString(engine_->GetContext(), str);
+    ReleaseCString(str);
 }
-void QuickJSNativeString::GetCString16(char16_t* buffer, size_t size, size_t* length)
+
+bool QuickJSNativeString::GetCStringView(const char** buffer, size_t* length)
 {
+    if (view_ == nullptr) {
+        view_ = JS_ToCStringLen(engine_->GetContext(), &viewLength_, value_);
+        if (view_ == nullptr) {
+            HILOG_ERROR("JS_ToCStringLen return value is null");
+            return false;
+        }
+    }
+    *buffer = view_;
+    *length = viewLength_;
+    return true;
+}
+
+const char* QuickJSNativeString::AcquireCString(size_t* length)
+{
+    if (view_ != nullptr) {
+        *length = viewLength_;
+        return view_;
+    }
+    // Converting without caching keeps a one-off read from holding a copy for the wrapper's lifetime
     const char* str = JS_ToCStringLen(engine_->GetContext(), length, value_);
     if (str == nullptr) {
         HILOG_ERROR("JS_ToCStringLen return value is null");
+    }
+    return str;
+}
+
+void QuickJSNativeString::ReleaseCString(const char* str)
+{
+    if (str != view_) {
+        JS_FreeCString(engine_->GetContext(), str);
+    }
+}
+
+void QuickJSNativeString::GetCString16(char16_t* buffer, size_t size, size_t* length)
+{
+    if (length == nullptr) {
         return;
     }
-    if (length != nullptr) {
-        auto ret = Utf8ToUtf16Length(str, strlen(str));
-        if (ret == -1) {
-            HILOG_ERROR("JS_ToCStringLen length is invalid");
-            JS_FreeCString(engine_->GetContext(), str);
-            return;
-        }
-        *length = ret;
-        if (buffer != nullptr) {
-            memset_s(buffer, sizeof(char16_t) * size, 0x0, sizeof(char16_t) * size);
-            Utf8ToUtf16(str, strlen(str), buffer, size);
-        }
+    size_t strLength = 0;
+    const char* str = AcquireCString(&strLength);
+    if (str == nullptr) {
+        return;
     }
-    JS_FreeCString(engine_->GetContext(), str);
+    *length = Unicode::Utf8ToUtf16Length(str, strLength);
+    if (buffer != nullptr && size > 0) {
+        size_t copied = Unicode::Utf8ToUtf16(str, strLength, buffer, size - 1);
+        buffer[copied] = u'\0';
+    }
+    ReleaseCString(str);
 }
 
 size_t QuickJSNativeString::GetLength()
@@ -99,149 +152,39 @@ size_t QuickJSNativeString::EncodeWriteUtf8(char* buffer, size_t bufferSize, int
         return 0;
     }
 
-    JSContext* ctx = engine_->GetContext();
-    JSValue lengthVal = JS_GetPropertyStr(ctx, value_, "length");
-    if (JS_IsException(lengthVal)) {
-        HILOG_ERROR("Failed to obtain the length");
-        return 0;
-    }
-    uint32_t len = 0;
-    if (JS_ToUint32(ctx, &len, lengthVal)) {
-        JS_FreeValue(ctx, lengthVal);
-        HILOG_ERROR("Cannot convert length to uint32_t");
+    size_t length = 0;
+    *nchars = 0;
+    const char* str = AcquireCString(&length);
+    if (str == nullptr) {
         return 0;
     }
 
+    // Only whole code points are written, a surrogate pair counts as two chars
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(str);
+    size_t limit = std::min(length, bufferSize);
     size_t pos = 0;
-    size_t writableSize = bufferSize;
-    uint32_t i = 0;
-    for (; i < len; i++) {
-        JSValue ch = JS_GetPropertyUint32(ctx, value_, i);
-        size_t chLen = 0;
-        const char* str = JS_ToCStringLen(ctx, &chLen, ch);
-        JS_FreeValue(ctx, ch);
-        if (chLen > writableSize) {
-            JS_FreeCString(ctx, str);
+    int32_t chars = 0;
+    while (pos < limit) {
+        size_t asciiLength = Unicode::AsciiPrefixLength(str + pos, limit - pos);
+        pos += asciiLength;
+        chars += static_cast<int32_t>(asciiLength);
+        if (pos >= limit) {
             break;
         }
-
-        int ret = memcpy_s((buffer + pos), writableSize, str, chLen);
-        if (ret != EOK) {
-            HILOG_ERROR("memcpy_s failed");
-            JS_FreeCString(ctx, str);
+        size_t charLength = Utf8CodePointLen(src[pos]);
+        if (charLength > bufferSize - pos || charLength > length - pos) {
             break;
         }
-
-        writableSize -= chLen;
-        pos = bufferSize - writableSize;
-        JS_FreeCString(ctx, str);
-    }
-
-    *nchars = i;
-    JS_FreeValue(ctx, lengthVal);
-    return pos;
-}
-
-char16_t* QuickJSNativeString::Utf8ToUtf16(const char* utf8Str, size_t u8len, char16_t* u16str, size_t u16len)
-{
-    if (u16len == 0) {
-        return u16str;
-    }
-    const char* u8end = utf8Str + u8len;
-    const char* u8cur = utf8Str;
-    const char16_t* u16end = u16str + u16len - 1;
-    constexpr uint8_t  offset = 10;
-    char16_t* u16cur = u16str;
-
-    while ((u8cur < u8end) && (u16cur < u16end)) {
-        size_t len = Utf8CodePointLen(*u8cur);
-        uint32_t codepoint = Utf8ToUtf32CodePoint(u8cur, len);
-        // Convert the UTF32 codepoint to one or more UTF16 codepoints
-        if (codepoint <= 0xFFFF) {
-            // Single UTF16 character
-            *u16cur++ = (char16_t)codepoint;
-        } else {
-            // Multiple UTF16 characters with surrogates
-            codepoint = codepoint - 0x10000;
-            *u16cur++ = (char16_t)((codepoint >> offset) + 0xD800);
-            if (u16cur >= u16end) {
-                // Ooops...  not enough room for this surrogate pair.
-                return u16cur - 1;
-            }
-            *u16cur++ = (char16_t)((codepoint & 0x3FF) + 0xDC00);
-        }
-
-        u8cur += len;
-    }
-    return u16cur;
-}
-
-size_t QuickJSNativeString::Utf8CodePointLen(uint8_t ch)
-{
-    constexpr uint8_t offset = 3;
-    return ((0xe5000000 >> ((ch >> offset) & 0x1e)) & offset) + 1;
-}
-
-uint32_t QuickJSNativeString::Utf8ToUtf32CodePoint(const char* src, size_t length)
-{
-    uint32_t unicode = 0;
-    constexpr size_t lengthSizeOne = 1;
-    constexpr size_t lengthSizeTwo = 2;
-    constexpr size_t lengthSizeThree = 3;
-    constexpr size_t lengthSizeFour = 4;
-    constexpr size_t offsetZero = 0;
-    constexpr size_t offsetOne = 1;
-    constexpr size_t offsetTwo = 2;
-    constexpr size_t offsetThree = 3;
-    switch (length) {
-        case lengthSizeOne:
-            return src[offsetZero];
-        case lengthSizeTwo:
-            unicode = src[offsetZero] & 0x1f;
-            Utf8ShiftAndMask(&unicode, src[offsetOne]);
-            return unicode;
-        case lengthSizeThree:
-            unicode = src[offsetZero] & 0x0f;
-            Utf8ShiftAndMask(&unicode, src[offsetOne]);
-            Utf8ShiftAndMask(&unicode, src[offsetTwo]);
-            return unicode;
-        case lengthSizeFour:
-            unicode = src[offsetZero] & 0x07;
-            Utf8ShiftAndMask(&unicode, src[offsetOne]);
-            Utf8ShiftAndMask(&unicode, src[offsetTwo]);
-            Utf8ShiftAndMask(&unicode, src[offsetThree]);
-            return unicode;
-        default:
-            return 0xffff;
+        pos += charLength;
+        chars += (charLength == UTF8_SURROGATE_PAIR_LENGTH) ? 2 : 1;
     }
-}
 
-void QuickJSNativeString::Utf8ShiftAndMask(uint32_t* codePoint, const uint8_t byte)
-{
-    *codePoint <<= 6;
-    *codePoint |= 0x3F & byte;
-}
-
-int QuickJSNativeString::Utf8ToUtf16Length(const char* str8, size_t str8Len)
-{
-    const char* str8end = str8 + str8Len;
-    int utf16len = 0;
-    while (str8 < str8end) {
-        utf16len++;
-        size_t u8charlen = Utf8CodePointLen(*str8);
-        if (str8 + u8charlen - 1 >= str8end) {
-            HILOG_ERROR("Get str16 length failed because str8 unicode is illegal!");
-            return -1;
-        }
-        uint32_t codepoint = Utf8ToUtf32CodePoint(str8, u8charlen);
-        if (codepoint > 0xFFFF) {
-            utf16len++; // this will be a surrogate pair in utf16
-        }
-        str8 += u8charlen;
-    }
-    if (str8 != str8end) {
-        HILOG_ERROR("Get str16 length failed because str8length is illegal!");
-        return -1;
+    if (pos > 0 && memcpy_s(buffer, bufferSize, str, pos) != EOK) {
+        HILOG_ERROR("memcpy_s failed");
+        ReleaseCString(str);
+        return 0;
     }
-    return utf16len;
+    ReleaseCString(str);
+    *nchars = chars;
+    return pos;
 }
@@ -32,13 +32,16 @@ public:
     void GetCString16(char16_t* buffer, size_t size, size_t* length) override;
     size_t GetLength() override;
     size_t EncodeWriteUtf8(char* buffer, size_t bufferSize, int32_t* nchars) override;
+    bool GetCStringView(const char** buffer, size_t* length) override;
 
 private:
-    char16_t* Utf8ToUtf16(const char* utf8Str, size_t u8len, char16_t* u16str, size_t u16len);
-    static inline size_t Utf8CodePointLen(uint8_t ch);
-    uint32_t Utf8ToUtf32CodePoint(const char* src, size_t length);
-    static inline void Utf8ShiftAndMask(uint32_t* codePoint, const uint8_t byte);
-    int Utf8ToUtf16Length(const char* str8, size_t str8Len);
+    // The cached view when there is one, otherwise a copy that ReleaseCString frees
+    const char* AcquireCString(size_t* length);
+    void ReleaseCString(const char* str);
+
+    // JS_ToCStringLen result kept for GetCStringView, shares the string buffer when it is 8-bit ASCII
+    const char* view_ = nullptr;
+    size_t viewLength_ = 0;
 };
 
 #endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_IMPL_QUICKJS_NATIVE_VALUE_QUICKJS_NATIVE_STRING_H */
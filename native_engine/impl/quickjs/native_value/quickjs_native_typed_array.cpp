@@ -18,7 +18,7 @@
 #include <string.h>
 
 QuickJSNativeTypedArray::QuickJSNativeTypedArray(QuickJSNativeEngine* engine, JSValue value)
-    : QuickJSNativeObject(engine, value)
+    : QuickJSNativeObject(engine, value, NATIVE_OBJECT)
 {
 }
 
@@ -29,46 +29,23 @@ QuickJSNativeTypedArray::QuickJSNativeTypedArray(QuickJSNativeEngine* engine,
                                                  size_t offset)
     : QuickJSNativeTypedArray(engine, JS_NULL)
 {
-    JSValue jsGlobal = JS_GetGlobalObject(engine_->GetContext());
-    JSValue jsType;
     switch (type) {
-        case NativeTypedArrayType::NATIVE_UINT8_CLAMPED_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "Uint8ClampedArray");
-            break;
-        case NativeTypedArrayType::NATIVE_INT8_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "Int8Array");
-            break;
-        case NativeTypedArrayType::NATIVE_UINT8_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "Uint8Array");
-            break;
         case NativeTypedArrayType::NATIVE_INT16_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "Int16Array");
             length = length / sizeof(int16_t);
             break;
         case NativeTypedArrayType::NATIVE_UINT16_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "Uint16Array");
             length = length / sizeof(uint16_t);
             break;
         case NativeTypedArrayType::NATIVE_INT32_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "Int32Array");
             length = length / sizeof(int32_t);
             break;
         case NativeTypedArrayType::NATIVE_UINT32_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "Uint32Array");
             length = length / sizeof(uint32_t);
             break;
-        case NativeTypedArrayType::NATIVE_BIGINT64_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "BigInt64Array");
-            break;
-        case NativeTypedArrayType::NATIVE_BIGUINT64_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "BigUint64Array");
-            break;
         case NativeTypedArrayType::NATIVE_FLOAT32_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "Float32Array");
             length = length / sizeof(float);
             break;
         case NativeTypedArrayType::NATIVE_FLOAT64_ARRAY:
-            jsType = JS_GetPropertyStr(engine_->GetContext(), jsGlobal, "Float64Array");
             length = length / sizeof(double);
             break;
         default:;
@@ -78,9 +55,10 @@ QuickJSNativeTypedArray::QuickJSNativeTypedArray(QuickJSNativeEngine* engine,
         JS_NewInt64(engine_->GetContext(), offset),
         JS_NewInt64(engine_->GetContext(), length),
     };
-    value_ = JS_CallConstructor(engine_->GetContext(), jsType, 3, params);
-    JS_FreeValue(engine_->GetContext(), jsType);
-    JS_FreeValue(engine_->GetContext(), jsGlobal);
+    value_ = JS_CallConstructor(engine_->GetContext(), engine_->GetTypedArrayConstructor(type), 3, params);
+    if (JS_IsException(value_)) {
+        type_ = NATIVE_UNDEFINED;
+    }
 }
 
 QuickJSNativeTypedArray::~QuickJSNativeTypedArray() {}
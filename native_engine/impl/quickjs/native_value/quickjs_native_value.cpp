@@ -21,9 +21,15 @@
 #include "quickjs_native_string.h"
 
 QuickJSNativeValue::QuickJSNativeValue(QuickJSNativeEngine* engine, JSValue value)
+    : QuickJSNativeValue(engine, value, GetValueType(engine->GetContext(), value))
+{
+}
+
+QuickJSNativeValue::QuickJSNativeValue(QuickJSNativeEngine* engine, JSValue value, NativeValueType type)
 {
     value_ = value;
     engine_ = engine;
+    type_ = type;
     NativeScopeManager* scopeManager = engine_->GetScopeManager();
     if (scopeManager != nullptr) {
         scopeManager->CreateHandle(this);
@@ -42,41 +48,7 @@ void* QuickJSNativeValue::GetInterface(int interfaceId)
 
 NativeValueType QuickJSNativeValue::TypeOf()
 {
-    NativeValueType result;
-    switch (JS_VALUE_GET_NORM_TAG((JSValue)value_)) {
-        case JS_TAG_BIG_INT:
-        case JS_TAG_BIG_FLOAT:
-            result = NativeValueType::NATIVE_BIGINT;
-            break;
-        case JS_TAG_SYMBOL:
-            result = NativeValueType::NATIVE_SYMBOL;
-            break;
-        case JS_TAG_STRING:
-            result = NativeValueType::NATIVE_STRING;
-            break;
-        case JS_TAG_OBJECT:
-            if (JS_IsFunction(engine_->GetContext(), value_)) {
-                result = NativeValueType::NATIVE_FUNCTION;
-            } else if (JS_IsExternal(engine_->GetContext(), value_)) {
-                result = NativeValueType::NATIVE_EXTERNAL;
-            } else {
-                result = NativeValueType::NATIVE_OBJECT;
-            }
-            break;
-        case JS_TAG_INT:
-        case JS_TAG_FLOAT64:
-            result = NativeValueType::NATIVE_NUMBER;
-            break;
-        case JS_TAG_BOOL:
-            result = NativeValueType::NATIVE_BOOLEAN;
-            break;
-        case JS_TAG_NULL:
-            result = NativeValueType::NATIVE_NULL;
-            break;
-        default:
-            result = NativeValueType::NATIVE_UNDEFINED;
-    }
-    return result;
+    return type_;
 }
 
 bool QuickJSNativeValue::InstanceOf(NativeValue* obj)
@@ -242,3 +214,42 @@ bool QuickJSNativeValue::StrictEquals(NativeValue* value)
 {
     return JS_StrictEquals(engine_->GetContext(), value_, *value);
 }
+
+NativeValueType QuickJSNativeValue::GetValueType(JSContext* context, JSValue value)
+{
+    NativeValueType result;
+    switch (JS_VALUE_GET_NORM_TAG(value)) {
+        case JS_TAG_BIG_INT:
+        case JS_TAG_BIG_FLOAT:
+            result = NativeValueType::NATIVE_BIGINT;
+            break;
+        case JS_TAG_SYMBOL:
+            result = NativeValueType::NATIVE_SYMBOL;
+            break;
+        case JS_TAG_STRING:
+            result = NativeValueType::NATIVE_STRING;
+            break;
+        case JS_TAG_OBJECT:
+            if (JS_IsFunction(context, value)) {
+                result = NativeValueType::NATIVE_FUNCTION;
+            } else if (JS_IsExternal(context, value)) {
+                result = NativeValueType::NATIVE_EXTERNAL;
+            } else {
+                result = NativeValueType::NATIVE_OBJECT;
+            }
+            break;
+        case JS_TAG_INT:
+        case JS_TAG_FLOAT64:
+            result = NativeValueType::NATIVE_NUMBER;
+            break;
+        case JS_TAG_BOOL:
+            result = NativeValueType::NATIVE_BOOLEAN;
+            break;
+        case JS_TAG_NULL:
+            result = NativeValueType::NATIVE_NULL;
+            break;
+        default:
+            result = NativeValueType::NATIVE_UNDEFINED;
+    }
+    return result;
+}
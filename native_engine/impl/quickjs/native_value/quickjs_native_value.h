@@ -23,6 +23,7 @@
 class QuickJSNativeValue : public NativeValue {
 public:
     QuickJSNativeValue(QuickJSNativeEngine* engine, JSValue value);
+    QuickJSNativeValue(QuickJSNativeEngine* engine, JSValue value, NativeValueType type);
     ~QuickJSNativeValue() override;
 
     void* GetInterface(int interfaceId) override;
@@ -65,8 +66,11 @@ public:
 
     bool StrictEquals(NativeValue* value) override;
 
+    static NativeValueType GetValueType(JSContext* context, JSValue value);
+
 protected:
     QuickJSNativeEngine* engine_;
+    NativeValueType type_;
 };
 
 #endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_IMPL_QUICKJS_NATIVE_VALUE_QUICKJS_NATIVE_VALUE_H */
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "quickjs_buffer_pool.h"
+
+#include <new>
+
+#include "securec.h"
+#include "utils/log.h"
+
+namespace {
+constexpr size_t SLICE_ALIGNMENT = 8;
+constexpr size_t FREE_SLAB_CAPACITY = 4;
+} // namespace
+
+struct QuickJSBufferPool::Slab {
+    QuickJSBufferPool* pool = nullptr;
+    size_t used = 0;
+    // One per ArrayBuffer using the slab, plus one while it is the current slab
+    size_t refCount = 0;
+    alignas(SLICE_ALIGNMENT) uint8_t data[SLAB_SIZE];
+};
+
+QuickJSBufferPool::~QuickJSBufferPool() = default;
+
+JSValue QuickJSBufferPool::NewArrayBuffer(JSContext* context, size_t length)
+{
+    if (length == 0 || length >= POOL_THRESHOLD || !enabled_ || detached_) {
+        return JS_NewArrayBufferCopy(context, nullptr, length);
+    }
+    size_t size = (length + SLICE_ALIGNMENT - 1) & ~(SLICE_ALIGNMENT - 1);
+    if (current_ == nullptr || current_->used + size > SLAB_SIZE) {
+        if (current_ != nullptr) {
+            Slab* full = current_;
+            current_ = nullptr;
+            ReleaseSlab(full);
+        }
+        current_ = NewSlab();
+        if (current_ == nullptr) {
+            return JS_NewArrayBufferCopy(context, nullptr, length);
+        }
+    }
+
+    uint8_t* slice = current_->data + current_->used;
+    JSValue result = JS_NewArrayBuffer(context, slice, length, FreeSlice, current_, false);
+    if (JS_IsException(result)) {
+        return result;
+    }
+    // Recycled slabs hold old contents
+    if (memset_s(slice, length, 0, length) != EOK) {
+        HILOG_ERROR("memset_s failed");
+    }
+    current_->used += size;
+    current_->refCount++;
+    return result;
+}
+
+void QuickJSBufferPool::SetEnabled(bool enabled)
+{
+    enabled_ = enabled;
+}
+
+void QuickJSBufferPool::Detach()
+{
+    detached_ = true;
+    for (Slab* slab : freeSlabs_) {
+        delete slab;
+        slabCount_--;
+    }
+    freeSlabs_.clear();
+    if (current_ != nullptr) {
+        Slab* slab = current_;
+        current_ = nullptr;
+        ReleaseSlab(slab);
+    }
+    DeleteIfUnused();
+}
+
+QuickJSBufferPool::Slab* QuickJSBufferPool::NewSlab()
+{
+    Slab* slab = nullptr;
+    if (!freeSlabs_.empty()) {
+        slab = freeSlabs_.back();
+        freeSlabs_.pop_back();
+    } else {
+        slab = new (std::nothrow) Slab;
+        if (slab == nullptr) {
+            HILOG_ERROR("allocate buffer slab failed");
+            return nullptr;
+        }
+        slab->pool = this;
+        slabCount_++;
+    }
+    slab->used = 0;
+    slab->refCount = 1;
+    return slab;
+}
+
+void QuickJSBufferPool::ReleaseSlab(Slab* slab)
+{
+    if (--slab->refCount > 0) {
+        return;
+    }
+    if (!detached_ && freeSlabs_.size() < FREE_SLAB_CAPACITY) {
+        freeSlabs_.push_back(slab);
+        return;
+    }
+    delete slab;
+    slabCount_--;
+}
+
+void QuickJSBufferPool::DeleteIfUnused()
+{
+    if (detached_ && slabCount_ == 0) {
+        delete this;
+    }
+}
+
+void QuickJSBufferPool::FreeSlice(JSRuntime* runtime, void* opaque, void* ptr)
+{
+    // Detaching frees the slice, the finalizer of the detached ArrayBuffer then calls again with no data
+    if (ptr == nullptr) {
+        return;
+    }
+    auto slab = reinterpret_cast<Slab*>(opaque);
+    QuickJSBufferPool* pool = slab->pool;
+    pool->ReleaseSlab(slab);
+    pool->DeleteIfUnused();
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_IMPL_QUICKJS_QUICKJS_BUFFER_POOL_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_IMPL_QUICKJS_QUICKJS_BUFFER_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "quickjs_headers.h"
+
+/*
+ * Backing store for small Buffers.
+ * Lengths below POOL_THRESHOLD are carved out of shared 8 KB slabs instead of taking a malloc each.
+ * A slab is recycled once every ArrayBuffer using it has been freed, so one long lived slice keeps its whole slab.
+ * The pool belongs to one engine and is only used on its thread. The engine calls Detach instead of deleting it,
+ * slabs still referenced by ArrayBuffers keep the pool alive until the context frees them.
+ */
+class QuickJSBufferPool {
+public:
+    static constexpr size_t SLAB_SIZE = 8 * 1024;
+    static constexpr size_t POOL_THRESHOLD = SLAB_SIZE / 2;
+
+    QuickJSBufferPool() = default;
+
+    QuickJSBufferPool(const QuickJSBufferPool&) = delete;
+    QuickJSBufferPool& operator=(const QuickJSBufferPool&) = delete;
+
+    // Zero-filled ArrayBuffer of length bytes, pooled when small enough
+    JSValue NewArrayBuffer(JSContext* context, size_t length);
+    // While disabled every Buffer takes its own allocation, slices already handed out stay valid
+    void SetEnabled(bool enabled);
+    void Detach();
+
+private:
+    struct Slab;
+
+    ~QuickJSBufferPool();
+
+    Slab* NewSlab();
+    void ReleaseSlab(Slab* slab);
+    void DeleteIfUnused();
+    static void FreeSlice(JSRuntime* runtime, void* opaque, void* ptr);
+
+    Slab* current_ = nullptr;
+    std::vector<Slab*> freeSlabs_;
+    size_t slabCount_ = 0;
+    bool enabled_ = true;
+    bool detached_ = false;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_IMPL_QUICKJS_QUICKJS_BUFFER_POOL_H */
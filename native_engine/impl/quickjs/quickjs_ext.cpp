@@ -14,6 +14,8 @@
  */
 
 #include <cstring>
+#include <memory>
+#include <vector>
 
 #include "native_engine/native_value.h"
 #include "quickjs_headers.h"
@@ -24,19 +26,85 @@ struct JSObjectInfo {
     JSFinalizer finalizer = nullptr;
     void* data = nullptr;
     void* hint = nullptr;
+    // napi_wrap slot, kept apart from the finalizer so wrapping and JS_AddFinalizer do not overwrite each other
+    NativeObjectInfo wrap;
+    NapiTypeTag typeTag = { 0, 0 };
+    bool hasTypeTag = false;
 };
 
 JSClassID g_baseClassId = 1;
 
+namespace {
+constexpr size_t OBJECT_INFO_POOL_CAPACITY = 256;
+
+// Finalized infos are kept for reuse, each runtime runs its finalizers on its own thread
+thread_local std::vector<std::unique_ptr<JSObjectInfo>> g_objectInfoPool;
+
+JSObjectInfo* NewObjectInfo(JSContext* context, JSFinalizer finalizer, void* data, void* hint)
+{
+    JSObjectInfo* info = nullptr;
+    if (!g_objectInfoPool.empty()) {
+        info = g_objectInfoPool.back().release();
+        g_objectInfoPool.pop_back();
+    } else {
+        info = new JSObjectInfo();
+    }
+    info->context = context;
+    info->finalizer = finalizer;
+    info->data = data;
+    info->hint = hint;
+    return info;
+}
+
+void DeleteObjectInfo(JSObjectInfo* info)
+{
+    if (g_objectInfoPool.size() < OBJECT_INFO_POOL_CAPACITY) {
+        *info = JSObjectInfo();
+        g_objectInfoPool.emplace_back(info);
+    } else {
+        delete info;
+    }
+}
+
+JSObjectInfo* GetObjectInfo(JSValueConst value)
+{
+    auto* info = reinterpret_cast<JSObjectInfo*>(JS_GetOpaque(value, GetBaseClassID()));
+    if (info == nullptr) {
+        info = reinterpret_cast<JSObjectInfo*>(JS_GetOpaque(value, GetExternalClassID()));
+    }
+    return info;
+}
+
+void FinalizeObjectInfo(JSRuntime* rt, JSValue val)
+{
+    auto* info = GetObjectInfo(val);
+    if (info != nullptr) {
+        if (info->finalizer != nullptr) {
+            info->finalizer(info->context, info->data, info->hint);
+        }
+        if (info->wrap.callback != nullptr) {
+            info->wrap.callback(info->wrap.engine, info->wrap.nativeObject, info->wrap.hint);
+        }
+        DeleteObjectInfo(info);
+    }
+}
+} // namespace
+
 void AddIntrinsicExternal(JSContext* context)
 {
     const char* className = "External";
+    const JSClassDef externalClassDef = {
+        .class_name = className,
+        .finalizer = FinalizeObjectInfo,
+    };
+    JS_NewClass(JS_GetRuntime(context), GetExternalClassID(), &externalClassDef);
+
     JSValue global = JS_GetGlobalObject(context);
     JSValue external = JS_NewCFunction2(
         context,
         [](JSContext* ctx, JSValueConst newTarget, int argc, JSValueConst* argv) {
             JSValue proto = JS_GetPropertyStr(ctx, newTarget, "prototype");
-            JSValue result = JS_NewObjectProtoClass(ctx, proto, GetBaseClassID());
+            JSValue result = JS_NewObjectProtoClass(ctx, proto, GetExternalClassID());
             JS_FreeValue(ctx, proto);
             return result;
         },
@@ -46,6 +114,8 @@ void AddIntrinsicExternal(JSContext* context)
     JS_DefinePropertyValueStr(context, external, "prototype", JS_DupValue(context, proto), 0);
     JS_DefinePropertyValueStr(
         context, proto, "constructor", JS_DupValue(context, external), JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+    // JS_NewObjectClass picks the prototype up from here, JS_NewExternal needs no global lookup
+    JS_SetClassProto(context, GetExternalClassID(), JS_DupValue(context, proto));
 
     JS_SetPropertyStr(context, global, "External", external);
     JS_FreeValue(context, proto);
@@ -57,42 +127,45 @@ JSClassID GetBaseClassID()
     return g_baseClassId;
 }
 
-JSValue JS_NewExternal(JSContext* context, void* value, JSFinalizer finalizer, void* hint)
+JSClassID GetExternalClassID()
 {
-    JSValue global = JS_GetGlobalObject(context);
-    JSValue external = JS_GetPropertyStr(context, global, "External");
-    JSValue result = JS_CallConstructor(context, external, 0, nullptr);
+    // Class IDs are process wide, each runtime registers the class itself in AddIntrinsicExternal
+    static JSClassID externalClassId = [] {
+        JSClassID classId = 0;
+        JS_NewClassID(&classId);
+        return classId;
+    }();
+    return externalClassId;
+}
 
-    auto info = new JSObjectInfo();
-    if (info != nullptr) {
-        info->context = context;
-        info->finalizer = finalizer;
-        info->data = value;
-        info->hint = hint;
-        JS_SetOpaque(result, info);
+JSValue JS_NewExternal(JSContext* context, void* value, JSFinalizer finalizer, void* hint)
+{
+    JSValue result = JS_NewObjectClass(context, GetExternalClassID());
+    if (JS_IsException(result)) {
+        return result;
     }
-
-    JS_FreeValue(context, external);
-    JS_FreeValue(context, global);
+    JS_SetOpaque(result, NewObjectInfo(context, finalizer, value, hint));
     return result;
 }
 
 void* JS_ExternalToNativeObject(JSContext* context, JSValue value)
 {
-    auto* info = reinterpret_cast<JSObjectInfo*>(JS_GetOpaque(value, GetBaseClassID()));
+    auto* info = GetObjectInfo(value);
     return (info != nullptr) ? info->data : nullptr;
 }
 
 bool JS_IsExternal(JSContext* context, JSValue value)
 {
-    bool result = false;
-    JSValue constructor = JS_GetPropertyStr(context, value, "constructor");
-    JSValue name = JS_GetPropertyStr(context, constructor, "name");
-    const char* cName = JS_ToCString(context, name);
-    result = !strcmp("External", cName ? cName : "");
-    JS_FreeCString(context, cName);
-    JS_FreeValue(context, name);
-    JS_FreeValue(context, constructor);
+    return JS_GetOpaque(value, GetExternalClassID()) != nullptr;
+}
+
+JSValue JS_NewBaseClassObject(JSContext* context, JSValueConst prototype)
+{
+    JSValue result = JS_NewObjectProtoClass(context, prototype, GetBaseClassID());
+    if (JS_IsException(result)) {
+        return result;
+    }
+    JS_SetOpaque(result, NewObjectInfo(context, nullptr, nullptr, nullptr));
     return result;
 }
 
@@ -100,71 +173,65 @@ void AddIntrinsicBaseClass(JSContext* context)
 {
     const JSClassDef baseClassDef = {
         .class_name = "BaseClass",
-        .finalizer =
-            [](JSRuntime* rt, JSValue val) {
-                auto* info = reinterpret_cast<JSObjectInfo*>(JS_GetOpaque(val, GetBaseClassID()));
-                if (info != nullptr) {
-                    info->finalizer(info->context, info->data, info->hint);
-                    delete info;
-                }
-            },
+        .finalizer = FinalizeObjectInfo,
     };
 
     JS_NewClassID(&g_baseClassId);
     JS_NewClass(JS_GetRuntime(context), g_baseClassId, &baseClassDef);
 }
 
-void JS_AddFinalizer(JSContext* context, JSValue value, void* pointer, JSFinalizer finalizer, void* hint)
+bool JS_AddFinalizer(JSContext* context, JSValue value, void* pointer, JSFinalizer finalizer, void* hint)
 {
-    auto* info = reinterpret_cast<JSObjectInfo*>(JS_GetOpaque(value, GetBaseClassID()));
-    if (info == nullptr) {
-        info = new JSObjectInfo();
-        if (info != nullptr) {
-            info->context = context;
-            info->finalizer = finalizer;
-            info->data = pointer;
-            info->hint = hint;
-        }
-    }
-
-    if (info) {
-        JS_SetOpaque(value, info);
+    // Other classes, native functions and class constructors among them, keep their own data in the opaque slot
+    auto* info = GetObjectInfo(value);
+    if (info == nullptr || info->finalizer != nullptr) {
+        return false;
     }
+    info->context = context;
+    info->finalizer = finalizer;
+    info->data = pointer;
+    info->hint = hint;
+    return true;
 }
 
 void JS_FreeFinalizer(JSValue value)
 {
-    auto* info = reinterpret_cast<JSObjectInfo*>(JS_GetOpaque(value, GetBaseClassID()));
+    // The record stays until the object is finalized, only the finalizer is dropped
+    auto* info = GetObjectInfo(value);
     if (info != nullptr) {
-        delete info;
-        info = nullptr;
-        JS_SetOpaque(value, info);
+        info->finalizer = nullptr;
+        info->hint = nullptr;
     }
 }
 
-void JS_SetNativePointer(JSContext* context, JSValue value, void* pointer, JSFinalizer finalizer, void* hint)
+NativeObjectInfo* JS_GetWrapInfo(JSValueConst value)
 {
-    auto* info = reinterpret_cast<JSObjectInfo*>(JS_GetOpaque(value, GetBaseClassID()));
+    auto* info = GetObjectInfo(value);
+    return (info != nullptr) ? &info->wrap : nullptr;
+}
+
+int JS_SetTypeTag(JSContext* context, JSValueConst value, const NapiTypeTag* typeTag)
+{
+    auto* info = GetObjectInfo(value);
     if (info == nullptr) {
-        info = new JSObjectInfo();
-        if (info != nullptr) {
-            info->context = context;
-            info->finalizer = finalizer;
-            info->data = pointer;
-            info->hint = hint;
-        }
-    } else if (pointer == nullptr) {
-        delete info;
-        info = nullptr;
+        return -1;
     }
-
-    JS_SetOpaque(value, info);
+    if (info->hasTypeTag) {
+        return 0;
+    }
+    info->typeTag = *typeTag;
+    info->hasTypeTag = true;
+    return 1;
 }
 
-void* JS_GetNativePointer(JSContext* context, JSValue value)
+int JS_CheckTypeTag(JSValueConst value, const NapiTypeTag* typeTag)
 {
-    auto* info = reinterpret_cast<JSObjectInfo*>(JS_GetOpaque(value, GetBaseClassID()));
-    return (info != nullptr) ? info->data : nullptr;
+    auto* info = GetObjectInfo(value);
+    if (info == nullptr) {
+        return -1;
+    }
+    return (info->hasTypeTag && info->typeTag.lower == typeTag->lower && info->typeTag.upper == typeTag->upper)
+        ? 1 : 0;
 }
 
 bool JS_IsPromise(JSContext* context, JSValue value)
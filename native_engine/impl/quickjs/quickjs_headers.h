@@ -24,7 +24,11 @@ extern "C" {
 
 typedef void (*JSFinalizer)(JSContext* context, void* data, void* hint);
 
+struct NativeObjectInfo;
+struct NapiTypeTag;
+
 JSClassID GetBaseClassID();
+JSClassID GetExternalClassID();
 
 void AddIntrinsicBaseClass(JSContext* context);
 void AddIntrinsicExternal(JSContext* context);
@@ -33,10 +37,16 @@ JSValue JS_NewExternal(JSContext* context, void* value, JSFinalizer finalizer, v
 void* JS_ExternalToNativeObject(JSContext* context, JSValue value);
 bool JS_IsExternal(JSContext* context, JSValue value);
 
-void JS_AddFinalizer(JSContext* context, JSValue value, void* pointer, JSFinalizer finalizer, void* hint);
+// false for objects without a native record or with a finalizer already set
+bool JS_AddFinalizer(JSContext* context, JSValue value, void* pointer, JSFinalizer finalizer, void* hint);
 void JS_FreeFinalizer(JSValue value);
-void JS_SetNativePointer(JSContext* context, JSValue value, void* pointer, JSFinalizer finalizer, void* hint);
-void* JS_GetNativePointer(JSContext* context, JSValue value);
+// Base class object created with its native record, the wrap slot, finalizer and type tag live there
+JSValue JS_NewBaseClassObject(JSContext* context, JSValueConst prototype);
+// napi_wrap slot stored inline in the object's native record, nullptr for objects without one
+NativeObjectInfo* JS_GetWrapInfo(JSValueConst value);
+// Type tag stored next to the wrap slot, both return -1 for objects without an opaque slot
+int JS_SetTypeTag(JSContext* context, JSValueConst value, const NapiTypeTag* typeTag);
+int JS_CheckTypeTag(JSValueConst value, const NapiTypeTag* typeTag);
 
 bool JS_IsPromise(JSContext* context, JSValue value);
 bool JS_IsMapIterator(JSContext* context, JSValue value);
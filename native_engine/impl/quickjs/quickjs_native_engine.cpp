@@ -18,6 +18,7 @@
 #include <js_native_api.h>
 
 #include "native_engine/native_engine.h"
+#include "native_engine/native_argument_buffer.h"
 #include "native_engine/native_property.h"
 #include "native_value/quickjs_native_array.h"
 #include "native_value/quickjs_native_array_buffer.h"
@@ -32,6 +33,7 @@
 #include "native_value/quickjs_native_object.h"
 #include "native_value/quickjs_native_string.h"
 #include "native_value/quickjs_native_typed_array.h"
+#include "quickjs_buffer_pool.h"
 #include "quickjs_native_deferred.h"
 #include "quickjs_native_reference.h"
 #include "securec.h"
@@ -40,6 +42,134 @@
 static const int JS_WRITE_OBJ = (1 << 2) | (1 << 3);
 static const int JS_ATOM_MESSAGE = 51;
 
+namespace {
+// Opaque of a class constructor created by DefineClass
+struct NativeClassInfo {
+    NativeFunctionInfo functionInfo;
+    JSValue prototype = JS_UNDEFINED;
+};
+
+JSClassID GetNativeClassID()
+{
+    static JSClassID classId = [] {
+        JSClassID id = 0;
+        JS_NewClassID(&id);
+        return id;
+    }();
+    return classId;
+}
+
+JSValue ConstructNativeClass(
+    JSContext* ctx, JSValueConst funcObj, JSValueConst newTarget, int argc, JSValueConst* argv, int flags)
+{
+    if ((flags & JS_CALL_FLAG_CONSTRUCTOR) == 0) {
+        return JS_ThrowTypeError(ctx, "class constructors must be invoked with 'new'");
+    }
+    auto classInfo = reinterpret_cast<NativeClassInfo*>(JS_GetOpaque(funcObj, GetNativeClassID()));
+    if (classInfo == nullptr) {
+        HILOG_ERROR("classInfo is nullptr");
+        return JS_UNDEFINED;
+    }
+    NativeFunctionInfo* functionInfo = &classInfo->functionInfo;
+    QuickJSNativeEngine* engine = (QuickJSNativeEngine*)functionInfo->engine;
+    NativeScopeManager* scopeManager = engine->GetScopeManager();
+    if (scopeManager == nullptr) {
+        HILOG_ERROR("scopeManager is nullptr");
+        return JS_UNDEFINED;
+    }
+    NativeScope* scope = scopeManager->Open();
+    if (scope == nullptr) {
+        HILOG_ERROR("scope is nullptr");
+        return JS_UNDEFINED;
+    }
+
+    // Only subclasses constructed through super() need their own prototype looked up
+    JSValue prototype = JS_UNDEFINED;
+    if (JS_VALUE_GET_PTR(newTarget) == JS_VALUE_GET_PTR(funcObj)) {
+        prototype = JS_DupValue(ctx, classInfo->prototype);
+    } else {
+        prototype = JS_GetPropertyStr(ctx, newTarget, "prototype");
+        if (JS_IsException(prototype)) {
+            scopeManager->Close(scope);
+            return prototype;
+        }
+        if (!JS_IsObject(prototype)) {
+            // Like ordinary constructors, fall back to the class's own prototype
+            JS_FreeValue(ctx, prototype);
+            prototype = JS_DupValue(ctx, classInfo->prototype);
+        }
+    }
+
+    NativeCallbackInfo callbackInfo;
+    NativeArgumentBuffer<NativeValue*> nativeArgv(argc);
+    if (nativeArgv.Data() == nullptr) {
+        JS_FreeValue(ctx, prototype);
+        scopeManager->Close(scope);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    QuickJSNativeFunction::CallFrame frame = { ctx, JS_UNDEFINED, newTarget, argv };
+    callbackInfo.argc = argc;
+    callbackInfo.argv = nativeArgv.Data();
+    callbackInfo.functionInfo = functionInfo;
+    callbackInfo.wrapper = QuickJSNativeFunction::WrapCallbackValue;
+    callbackInfo.rawInfo = &frame;
+    callbackInfo.scope = scope;
+    // The instance and its native record are created up front, arguments and new.target are wrapped on demand
+    JSValue instance = JS_NewBaseClassObject(ctx, prototype);
+    JS_FreeValue(ctx, prototype);
+    if (JS_IsException(instance)) {
+        scopeManager->Close(scope);
+        return instance;
+    }
+    callbackInfo.thisVar = QuickJSNativeEngine::JSValueToNativeValue(engine, instance);
+
+    NativeValue* value = functionInfo->callback(engine, &callbackInfo);
+
+    JSValue result = JS_UNDEFINED;
+    if (value != nullptr) {
+        result = JS_DupValue(ctx, *value);
+    } else if (engine->IsExceptionPending()) {
+        NativeValue* error = engine->GetAndClearLastException();
+        if (error != nullptr) {
+            result = JS_DupValue(ctx, *error);
+        }
+    }
+
+    scopeManager->Close(scope);
+    return result;
+}
+
+void AddIntrinsicNativeClass(JSContext* context)
+{
+    const JSClassDef classDef = {
+        .class_name = "NativeClass",
+        .finalizer =
+            [](JSRuntime* rt, JSValue val) {
+                auto classInfo = reinterpret_cast<NativeClassInfo*>(JS_GetOpaque(val, GetNativeClassID()));
+                if (classInfo != nullptr) {
+                    JS_FreeValueRT(rt, classInfo->prototype);
+                    delete classInfo;
+                }
+            },
+        .gc_mark =
+            [](JSRuntime* rt, JSValueConst val, JS_MarkFunc* markFunc) {
+                auto classInfo = reinterpret_cast<NativeClassInfo*>(JS_GetOpaque(val, GetNativeClassID()));
+                if (classInfo != nullptr) {
+                    JS_MarkValue(rt, classInfo->prototype, markFunc);
+                }
+            },
+        .call = ConstructNativeClass,
+    };
+    JS_NewClass(JS_GetRuntime(context), GetNativeClassID(), &classDef);
+
+    JSValue global = JS_GetGlobalObject(context);
+    JSValue functionConstructor = JS_GetPropertyStr(context, global, "Function");
+    JS_SetClassProto(context, GetNativeClassID(), JS_GetPropertyStr(context, functionConstructor, "prototype"));
+    JS_FreeValue(context, functionConstructor);
+    JS_FreeValue(context, global);
+}
+} // namespace
+
 QuickJSNativeEngine::QuickJSNativeEngine(JSRuntime* runtime, JSContext* context, void* jsEngine)
     : NativeEngine(jsEngine)
 {
@@ -48,6 +178,10 @@ QuickJSNativeEngine::QuickJSNativeEngine(JSRuntime* runtime, JSContext* context,
 
     AddIntrinsicBaseClass(context_);
     AddIntrinsicExternal(context_);
+    QuickJSNativeFunction::AddIntrinsicNativeFunction(context_);
+    AddIntrinsicNativeClass(context_);
+    InitIntrinsicConstructors();
+    bufferPool_ = new QuickJSBufferPool();
 
     JSValue jsGlobal = JS_GetGlobalObject(context_);
     JSValue jsNativeEngine = (JSValue)JS_MKPTR(JS_TAG_INT, this);
@@ -144,6 +278,63 @@ QuickJSNativeEngine::~QuickJSNativeEngine()
 {
     // need to call deinit before base class.
     Deinit();
+    FreeIntrinsicConstructors();
+    // Pooled ArrayBuffers are freed with the context, after the engine
+    bufferPool_->Detach();
+    bufferPool_ = nullptr;
+}
+
+void QuickJSNativeEngine::InitIntrinsicConstructors()
+{
+    // Indexed by NativeTypedArrayType
+    static constexpr const char* typedArrayNames[] = {
+        "Int8Array",
+        "Uint8Array",
+        "Uint8ClampedArray",
+        "Int16Array",
+        "Uint16Array",
+        "Int32Array",
+        "Uint32Array",
+        "Float32Array",
+        "Float64Array",
+        "BigInt64Array",
+        "BigUint64Array",
+    };
+    static_assert(sizeof(typedArrayNames) / sizeof(typedArrayNames[0]) == TYPED_ARRAY_TYPE_COUNT,
+        "one constructor name per NativeTypedArrayType");
+
+    JSValue global = JS_GetGlobalObject(context_);
+    for (size_t i = 0; i < TYPED_ARRAY_TYPE_COUNT; i++) {
+        typedArrayConstructors_[i] = JS_GetPropertyStr(context_, global, typedArrayNames[i]);
+    }
+    dataViewConstructor_ = JS_GetPropertyStr(context_, global, "DataView");
+    JS_FreeValue(context_, global);
+}
+
+void QuickJSNativeEngine::FreeIntrinsicConstructors()
+{
+    for (size_t i = 0; i < TYPED_ARRAY_TYPE_COUNT; i++) {
+        JS_FreeValue(context_, typedArrayConstructors_[i]);
+        typedArrayConstructors_[i] = JS_UNDEFINED;
+    }
+    JS_FreeValue(context_, dataViewConstructor_);
+    dataViewConstructor_ = JS_UNDEFINED;
+}
+
+JSValue QuickJSNativeEngine::GetTypedArrayConstructor(NativeTypedArrayType type) const
+{
+    size_t index = static_cast<size_t>(type);
+    return (index < TYPED_ARRAY_TYPE_COUNT) ? typedArrayConstructors_[index] : JS_UNDEFINED;
+}
+
+JSValue QuickJSNativeEngine::GetDataViewConstructor() const
+{
+    return dataViewConstructor_;
+}
+
+QuickJSBufferPool* QuickJSNativeEngine::GetBufferPool() const
+{
+    return bufferPool_;
 }
 
 JSValue QuickJSNativeEngine::GetModuleFromName(
@@ -229,14 +420,37 @@ JSContext* QuickJSNativeEngine::GetContext()
 
 void QuickJSNativeEngine::Loop(LoopMode mode, bool needSync)
 {
-    JSContext* context = nullptr;
     NativeEngine::Loop(mode, needSync);
+    if (GetMicrotaskPolicy() == MICROTASK_BATCHED) {
+        RunMicrotasks(GetMicrotaskJobBudget());
+        return;
+    }
+    JSContext* context = nullptr;
     int err = JS_ExecutePendingJob(runtime_, &context);
     if (err < 0) {
         js_std_dump_error(context);
     }
 }
 
+void QuickJSNativeEngine::RunMicrotasks(uint32_t budget)
+{
+    if (budget == 0) {
+        // As calls always have, this also runs the quickjs-libc timers that are due, a budget limits it to jobs
+        js_std_loop(context_);
+        return;
+    }
+    JSContext* context = nullptr;
+    for (uint32_t i = 0; i < budget; i++) {
+        int err = JS_ExecutePendingJob(runtime_, &context);
+        if (err < 0) {
+            js_std_dump_error(context);
+        }
+        if (err <= 0) {
+            break;
+        }
+    }
+}
+
 NativeValue* QuickJSNativeEngine::GetGlobal()
 {
     JSValue value = JS_GetGlobalObject(context_);
@@ -245,12 +459,12 @@ NativeValue* QuickJSNativeEngine::GetGlobal()
 
 NativeValue* QuickJSNativeEngine::CreateNull()
 {
-    return new QuickJSNativeValue(this, JS_NULL);
+    return new QuickJSNativeValue(this, JS_NULL, NATIVE_NULL);
 }
 
 NativeValue* QuickJSNativeEngine::CreateUndefined()
 {
-    return new QuickJSNativeValue(this, JS_UNDEFINED);
+    return new QuickJSNativeValue(this, JS_UNDEFINED, NATIVE_UNDEFINED);
 }
 
 NativeValue* QuickJSNativeEngine::CreateBoolean(bool value)
@@ -298,6 +512,11 @@ NativeValue* QuickJSNativeEngine::CreateString16(const char16_t* value, size_t l
     return new QuickJSNativeString(this, value, length);
 }
 
+NativePropertyKey* QuickJSNativeEngine::CreatePropertyKey(const char* name, size_t length)
+{
+    return new QuickJSNativePropertyKey(this, name, length);
+}
+
 NativeValue* QuickJSNativeEngine::CreateSymbol(NativeValue* value)
 {
     JSValue symbol = { 0 };
@@ -313,7 +532,7 @@ NativeValue* QuickJSNativeEngine::CreateSymbol(NativeValue* value)
     JS_FreeValue(context_, global);
     js_std_loop(context_);
 
-    return new QuickJSNativeValue(this, symbol);
+    return new QuickJSNativeValue(this, symbol, NATIVE_SYMBOL);
 }
 
 NativeValue* QuickJSNativeEngine::CreateFunction(const char* name, size_t length, NativeCallback cb, void* value)
@@ -331,6 +550,43 @@ NativeValue* QuickJSNativeEngine::CreateObject()
     return new QuickJSNativeObject(this);
 }
 
+NativeValue* QuickJSNativeEngine::CreateObjectWithProperties(
+    NativeValue* prototype, const char* const* names, NativeValue* const* values, size_t count)
+{
+    JSValue object = (prototype == nullptr) ? JS_NewObject(context_) : JS_NewObjectProto(context_, *prototype);
+    if (JS_IsException(object)) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < count; i++) {
+        JSValue value = *values[i];
+        if (JS_DefinePropertyValueStr(context_, object, names[i], JS_DupValue(context_, value), JS_PROP_C_W_E) < 0) {
+            JS_FreeValue(context_, object);
+            return nullptr;
+        }
+    }
+    return new QuickJSNativeObject(this, object);
+}
+
+NativeValue* QuickJSNativeEngine::CreateObjectFromTemplate(
+    NativeObjectTemplate* objectTemplate, NativeValue* const* values)
+{
+    JSValue object = JS_NewObject(context_);
+    if (JS_IsException(object)) {
+        return nullptr;
+    }
+    // defining the same atoms in the same order walks the runtime's cached shape transitions
+    size_t count = objectTemplate->GetPropertyCount();
+    for (size_t i = 0; i < count; i++) {
+        JSAtom atom = static_cast<QuickJSNativePropertyKey*>(objectTemplate->GetPropertyKey(i))->GetAtom();
+        JSValue value = *values[i];
+        if (JS_DefinePropertyValue(context_, object, atom, JS_DupValue(context_, value), JS_PROP_C_W_E) < 0) {
+            JS_FreeValue(context_, object);
+            return nullptr;
+        }
+    }
+    return new QuickJSNativeObject(this, object);
+}
+
 NativeValue* QuickJSNativeEngine::CreateArrayBuffer(void** value, size_t length)
 {
     return new QuickJSNativeArrayBuffer(this, (uint8_t**)value, length);
@@ -346,6 +602,131 @@ NativeValue* QuickJSNativeEngine::CreateArray(size_t length)
     return new QuickJSNativeArray(this, length);
 }
 
+bool QuickJSNativeEngine::GetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue** result)
+{
+    JSValue value = *array;
+    for (uint32_t i = 0; i < count; i++) {
+        JSValue element = JS_GetPropertyUint32(context_, value, start + i);
+        if (JS_IsException(element)) {
+            return false;
+        }
+        result[i] = JSValueToNativeValue(this, element);
+    }
+    return true;
+}
+
+bool QuickJSNativeEngine::SetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue* const* values)
+{
+    JSValue value = *array;
+    for (uint32_t i = 0; i < count; i++) {
+        JSValue element = *values[i];
+        if (JS_SetPropertyUint32(context_, value, start + i, JS_DupValue(context_, element)) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool QuickJSNativeEngine::GetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, double* result)
+{
+    JSValue value = *array;
+    for (uint32_t i = 0; i < count; i++) {
+        JSValue element = JS_GetPropertyUint32(context_, value, start + i);
+        if (!JS_IsNumber(element)) {
+            JS_FreeValue(context_, element);
+            return false;
+        }
+        JS_ToFloat64(context_, &result[i], element);
+    }
+    return true;
+}
+
+bool QuickJSNativeEngine::GetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, int32_t* result)
+{
+    JSValue value = *array;
+    for (uint32_t i = 0; i < count; i++) {
+        JSValue element = JS_GetPropertyUint32(context_, value, start + i);
+        if (!JS_IsNumber(element)) {
+            JS_FreeValue(context_, element);
+            return false;
+        }
+        JS_ToInt32(context_, &result[i], element);
+    }
+    return true;
+}
+
+bool QuickJSNativeEngine::GetElementsUtf8(
+    NativeValue* array, uint32_t start, uint32_t count, const char** result, size_t* lengths)
+{
+    JSValue value = *array;
+    std::vector<const char*> strings(count, nullptr);
+    size_t size = 0;
+    bool success = true;
+    for (uint32_t i = 0; i < count; i++) {
+        JSValue element = JS_GetPropertyUint32(context_, value, start + i);
+        if (JS_IsString(element)) {
+            strings[i] = JS_ToCStringLen(context_, &lengths[i], element);
+        }
+        JS_FreeValue(context_, element);
+        if (strings[i] == nullptr) {
+            success = false;
+            break;
+        }
+        size += lengths[i] + 1;
+    }
+
+    // one scope allocation holds every string so callers don't have to release anything
+    char* buffer = success ? static_cast<char*>(GetScopeManager()->Allocate(size)) : nullptr;
+    for (uint32_t i = 0; i < count && strings[i] != nullptr; i++) {
+        if (buffer != nullptr) {
+            if (memcpy_s(buffer, lengths[i] + 1, strings[i], lengths[i] + 1) != EOK) {
+                HILOG_ERROR("memcpy_s failed");
+            }
+            result[i] = buffer;
+            buffer += lengths[i] + 1;
+        }
+        JS_FreeCString(context_, strings[i]);
+    }
+    return success && buffer != nullptr;
+}
+
+bool QuickJSNativeEngine::SetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, const double* values)
+{
+    JSValue value = *array;
+    for (uint32_t i = 0; i < count; i++) {
+        if (JS_SetPropertyUint32(context_, value, start + i, JS_NewFloat64(context_, values[i])) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool QuickJSNativeEngine::SetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, const int32_t* values)
+{
+    JSValue value = *array;
+    for (uint32_t i = 0; i < count; i++) {
+        if (JS_SetPropertyUint32(context_, value, start + i, JS_NewInt32(context_, values[i])) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool QuickJSNativeEngine::GetObjectIdentityHash(NativeValue* object, uint32_t* hash)
+{
+    // QuickJS never moves objects, the address identifies one until it is collected
+    JSValue value = *object;
+    if (!JS_IsObject(value)) {
+        return false;
+    }
+    // Objects are at least 8-byte aligned, the low bits carry no information
+    constexpr uint32_t alignmentBits = 3;
+    constexpr uint32_t highBits = 32;
+    uint64_t address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(JS_VALUE_GET_PTR(value))) >> alignmentBits;
+    *hash = static_cast<uint32_t>(address ^ (address >> highBits));
+    return true;
+}
+
 NativeValue* QuickJSNativeEngine::CreateDataView(NativeValue* value, size_t length, size_t offset)
 {
     return new QuickJSNativeDataView(this, value, length, offset);
@@ -365,7 +746,7 @@ NativeValue* QuickJSNativeEngine::CreatePromise(NativeDeferred** deferred)
     JSValue resolvingFuncs[2] = { 0 };
     promise = JS_NewPromiseCapability(context_, resolvingFuncs);
     *deferred = new QuickJSNativeDeferred(this, resolvingFuncs);
-    return new QuickJSNativeValue(this, promise);
+    return new QuickJSNativeValue(this, promise, NATIVE_OBJECT);
 }
 
 NativeValue* QuickJSNativeEngine::CreateError(NativeValue* code, NativeValue* message)
@@ -383,18 +764,15 @@ NativeValue* QuickJSNativeEngine::CreateError(NativeValue* code, NativeValue* me
 
 NativeValue* QuickJSNativeEngine::CreateInstance(NativeValue* constructor, NativeValue* const* argv, size_t argc)
 {
-    JSValue result = JS_UNDEFINED;
-    JSValue* params = nullptr;
-    if (argc > 0) {
-        params = new JSValue[argc];
-        for (size_t i = 0; i < argc && params != nullptr; i++) {
-            params[i] = *argv[i];
-        }
+    NativeArgumentBuffer<JSValue> params(argc);
+    if (params.Data() == nullptr) {
+        HILOG_ERROR("allocate arguments failed");
+        return nullptr;
     }
-    result = JS_CallConstructor(context_, *constructor, argc, params);
-    if (params != nullptr) {
-        delete[] params;
+    for (size_t i = 0; i < argc; i++) {
+        params[i] = *argv[i];
     }
+    JSValue result = JS_CallConstructor(context_, *constructor, argc, params.Data());
     return QuickJSNativeEngine::JSValueToNativeValue(this, result);
 }
 
@@ -412,35 +790,34 @@ NativeValue* QuickJSNativeEngine::CallFunction(NativeValue* thisVar,
     JSValue result = JS_UNDEFINED;
 
     if (function == nullptr) {
-        return new QuickJSNativeValue(this, JS_UNDEFINED);
+        return new QuickJSNativeValue(this, JS_UNDEFINED, NATIVE_UNDEFINED);
     }
 
     NativeScope* scope = scopeManager_->Open();
     if (scope == nullptr) {
         HILOG_ERROR("Open scope failed");
-        return new QuickJSNativeValue(this, JS_UNDEFINED);
+        return new QuickJSNativeValue(this, JS_UNDEFINED, NATIVE_UNDEFINED);
     }
 
-    JSValue* args = nullptr;
-    if (argc > 0) {
-        args = new JSValue[argc];
-        for (size_t i = 0; i < argc && args != nullptr; i++) {
-            if (argv[i] != nullptr) {
-                args[i] = *argv[i];
-            } else {
-                args[i] = JS_UNDEFINED;
-            }
+    NativeArgumentBuffer<JSValue> args(argc);
+    if (args.Data() == nullptr) {
+        HILOG_ERROR("allocate arguments failed");
+        scopeManager_->Close(scope);
+        return nullptr;
+    }
+    for (size_t i = 0; i < argc; i++) {
+        if (argv[i] != nullptr) {
+            args[i] = *argv[i];
+        } else {
+            args[i] = JS_UNDEFINED;
         }
     }
 
-    result = JS_Call(context_, *function, (thisVar != nullptr) ? (JSValue)*thisVar : JS_UNDEFINED, argc, args);
-    js_std_loop(context_);
+    result = JS_Call(
+        context_, *function, (thisVar != nullptr) ? (JSValue)*thisVar : JS_UNDEFINED, argc, args.Data());
+    MicrotaskCheckpoint();
     JS_DupValue(context_, result);
 
-    if (args != nullptr) {
-        delete[] args;
-    }
-
     scopeManager_->Close(scope);
 
     if (JS_IsError(context_, result) || JS_IsException(result)) {
@@ -459,7 +836,7 @@ NativeValue* QuickJSNativeEngine::RunScript(NativeValue* script)
     if (JS_IsError(context_, result) || JS_IsException(result)) {
         return nullptr;
     }
-    js_std_loop(context_);
+    MicrotaskCheckpoint();
 
     return JSValueToNativeValue(this, result);
 }
@@ -479,7 +856,7 @@ NativeValue* QuickJSNativeEngine::RunBufferScript(std::vector<uint8_t>& buffer)
     if (JS_IsError(context_, result) || JS_IsException(result)) {
         return nullptr;
     }
-    js_std_loop(context_);
+    MicrotaskCheckpoint();
     return JSValueToNativeValue(this, result);
 }
 
@@ -526,98 +903,25 @@ NativeValue* QuickJSNativeEngine::DefineClass(const char* name,
                                               const NativePropertyDescriptor* properties,
                                               size_t length)
 {
-    NativeFunctionInfo* functionInfo = new NativeFunctionInfo();
-    if (functionInfo == nullptr) {
-        HILOG_ERROR("new NativeFunctionInfo failed");
+    auto classInfo = new NativeClassInfo();
+    classInfo->functionInfo.engine = this;
+    classInfo->functionInfo.data = data;
+    classInfo->functionInfo.callback = callback;
+
+    // The constructor keeps its callback and prototype in its opaque, constructing reads no properties
+    JSValue classConstructor = JS_NewObjectClass(context_, GetNativeClassID());
+    if (JS_IsException(classConstructor)) {
+        delete classInfo;
         return nullptr;
     }
-    functionInfo->engine = this;
-    functionInfo->data = data;
-    functionInfo->callback = callback;
-
-    JSValue classConstructor = JS_NewCFunction2(
-        context_,
-        [](JSContext* ctx, JSValueConst newTarget, int argc, JSValueConst* argv) -> JSValue {
-            auto callbackInfo = new NativeCallbackInfo();
-            if (callbackInfo == nullptr) {
-                HILOG_ERROR("callbackInfo is nullptr");
-                return JS_UNDEFINED;
-            }
-            JSValue prototype = JS_GetPropertyStr(ctx, newTarget, "prototype");
-            JSValue classContext = JS_GetPropertyStr(ctx, newTarget, "_classContext");
-
-            auto functionInfo = (NativeFunctionInfo*)JS_ExternalToNativeObject(ctx, classContext);
-            if (functionInfo == nullptr) {
-                HILOG_ERROR("functionInfo is nullptr");
-                delete callbackInfo;
-                return JS_UNDEFINED;
-            }
-
-            QuickJSNativeEngine* engine = (QuickJSNativeEngine*)functionInfo->engine;
-            NativeScopeManager* scopeManager = engine->GetScopeManager();
-            if (scopeManager == nullptr) {
-                HILOG_ERROR("scopeManager is nullptr");
-                delete callbackInfo;
-                return JS_UNDEFINED;
-            }
-
-            NativeScope* scope = scopeManager->Open();
-            if (scope == nullptr) {
-                HILOG_ERROR("scope is nullptr");
-                delete callbackInfo;
-                return JS_UNDEFINED;
-            }
-
-            callbackInfo->argc = argc;
-            callbackInfo->argv = nullptr;
-            callbackInfo->function = JSValueToNativeValue(engine, JS_DupValue(ctx, newTarget));
-            callbackInfo->functionInfo = functionInfo;
-            callbackInfo->thisVar =
-                JSValueToNativeValue(engine, JS_NewObjectProtoClass(ctx, prototype, GetBaseClassID()));
-
-            if (callbackInfo->argc > 0) {
-                callbackInfo->argv = new NativeValue*[argc];
-                for (size_t i = 0; i < callbackInfo->argc && callbackInfo->argv != nullptr; i++) {
-                    callbackInfo->argv[i] = JSValueToNativeValue(engine, JS_DupValue(ctx, argv[i]));
-                }
-            }
-
-            NativeValue* value = functionInfo->callback(engine, callbackInfo);
-
-            if (callbackInfo != nullptr) {
-                delete []callbackInfo->argv;
-            }
-
-            JSValue result = JS_UNDEFINED;
-            if (value != nullptr) {
-                result = JS_DupValue(ctx, *value);
-            } else if (engine->IsExceptionPending()) {
-                NativeValue* error = engine->GetAndClearLastException();
-                if (error != nullptr) {
-                    result = JS_DupValue(ctx, *error);
-                }
-            }
-
-            delete callbackInfo;
-            scopeManager->Close(scope);
-
-            return result;
-        },
-        name, 0, JS_CFUNC_constructor_or_func, 0);
+    JS_SetOpaque(classConstructor, classInfo);
+    JS_SetConstructorBit(context_, classConstructor, true);
+    JS_DefinePropertyValueStr(context_, classConstructor, "name", JS_NewString(context_, name), JS_PROP_CONFIGURABLE);
     JSValue proto = JS_NewObject(context_);
+    classInfo->prototype = JS_DupValue(context_, proto);
 
-    QuickJSNativeObject* nativeClass = new QuickJSNativeObject(this, JS_DupValue(context_, classConstructor));
-    if (nativeClass == nullptr) {
-        delete functionInfo;
-        return nullptr;
-    }
-
+    QuickJSNativeObject* nativeClass = new QuickJSNativeObject(this, classConstructor);
     QuickJSNativeObject* nativeClassProto = new QuickJSNativeObject(this, proto);
-    if (nativeClassProto == nullptr) {
-        delete functionInfo;
-        delete nativeClass;
-        return nullptr;
-    }
 
     for (size_t i = 0; i < length; i++) {
         if (properties[i].attributes & NATIVE_STATIC) {
@@ -628,19 +932,6 @@ NativeValue* QuickJSNativeEngine::DefineClass(const char* name,
     }
 
     JS_DefinePropertyValueStr(context_, *nativeClass, "prototype", JS_DupValue(context_, *nativeClassProto), 0);
-
-    JSValue classContext = JS_NewExternal(
-        context_, functionInfo,
-        [](JSContext* ctx, void* data, void* hint) {
-            auto info = (NativeFunctionInfo*)data;
-            HILOG_INFO("_classContext Destroy");
-            if (info != nullptr) {
-                delete info;
-            }
-        },
-        nullptr);
-    JS_DefinePropertyValueStr(context_, *nativeClass, "_classContext", classContext, 0);
-
     JS_DefinePropertyValueStr(context_, *nativeClassProto, "constructor", JS_DupValue(context_, *nativeClass),
         JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
 
@@ -680,10 +971,10 @@ NativeValue* QuickJSNativeEngine::JSValueToNativeValue(QuickJSNativeEngine* engi
             result = new QuickJSNativeBigInt(engine, value);
             break;
         case JS_TAG_BIG_FLOAT:
-            result = new QuickJSNativeObject(engine, value);
+            result = new QuickJSNativeObject(engine, value, NATIVE_BIGINT);
             break;
         case JS_TAG_SYMBOL:
-            result = new QuickJSNativeValue(engine, value);
+            result = new QuickJSNativeValue(engine, value, NATIVE_SYMBOL);
             break;
         case JS_TAG_STRING:
             result = new QuickJSNativeString(engine, value);
@@ -692,9 +983,9 @@ NativeValue* QuickJSNativeEngine::JSValueToNativeValue(QuickJSNativeEngine* engi
             if (JS_IsArray(engine->GetContext(), value)) {
                 result = new QuickJSNativeArray(engine, value);
             } else if (JS_IsError(engine->GetContext(), value)) {
-                result = new QuickJSNativeValue(engine, value);
+                result = new QuickJSNativeValue(engine, value, NATIVE_OBJECT);
             } else if (JS_IsPromise(engine->GetContext(), value)) {
-                result = new QuickJSNativeValue(engine, value);
+                result = new QuickJSNativeValue(engine, value, NATIVE_OBJECT);
             } else if (JS_IsArrayBuffer(engine->GetContext(), value)) {
                 result = new QuickJSNativeArrayBuffer(engine, value);
             } else if (JS_IsBuffer(engine->GetContext(), value)) {
@@ -710,18 +1001,20 @@ NativeValue* QuickJSNativeEngine::JSValueToNativeValue(QuickJSNativeEngine* engi
             } else if (JS_IsDate(engine->GetContext(), value)) {
                 result = new QuickJSNativeDate(engine, value);
             } else {
-                result = new QuickJSNativeObject(engine, value);
+                result = new QuickJSNativeObject(engine, value, NATIVE_OBJECT);
             }
             break;
         case JS_TAG_BOOL:
             result = new QuickJSNativeBoolean(engine, value);
             break;
         case JS_TAG_NULL:
+            result = new QuickJSNativeValue(engine, value, NATIVE_NULL);
+            break;
         case JS_TAG_UNDEFINED:
         case JS_TAG_UNINITIALIZED:
         case JS_TAG_CATCH_OFFSET:
         case JS_TAG_EXCEPTION:
-            result = new QuickJSNativeValue(engine, value);
+            result = new QuickJSNativeValue(engine, value, NATIVE_UNDEFINED);
             break;
         case JS_TAG_INT:
         case JS_TAG_FLOAT64:
@@ -805,21 +1098,216 @@ bool QuickJSNativeEngine::DetachTransferList(JSValue transferList)
     return true;
 }
 
+namespace {
+void FreeTransferredBuffer(JSRuntime* runtime, void* opaque, void* ptr)
+{
+    free(ptr);
+}
+
+// Position of value in the transfer list, -1 if it is not transferred
+int FindTransferred(const std::vector<JSValue>& transferred, JSValueConst value)
+{
+    if (!JS_IsObject(value)) {
+        return -1;
+    }
+    for (size_t i = 0; i < transferred.size(); i++) {
+        if (JS_VALUE_GET_PTR(transferred[i]) == JS_VALUE_GET_PTR(value)) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+} // namespace
+
+bool QuickJSNativeEngine::IsPlainObject(JSValueConst value)
+{
+    if (!JS_IsObject(value)) {
+        return false;
+    }
+    JSValue global = JS_GetGlobalObject(context_);
+    JSValue objectConstructor = JS_GetPropertyStr(context_, global, "Object");
+    JSValue constructor = JS_GetPropertyStr(context_, value, "constructor");
+    bool result = JS_IsObject(constructor) && JS_VALUE_GET_PTR(constructor) == JS_VALUE_GET_PTR(objectConstructor);
+    JS_FreeValue(context_, constructor);
+    JS_FreeValue(context_, objectConstructor);
+    JS_FreeValue(context_, global);
+    return result;
+}
+
+// Transferred ArrayBuffers held by the message itself or by its own properties are replaced with undefined in
+// *stripped and recorded in slots, the receiving engine puts them back. Deeper ones are serialized by copy.
+bool QuickJSNativeEngine::StripTransferred(JSValueConst message, const std::vector<JSValue>& transferred,
+    JSValue* stripped, std::vector<SerializeData::TransferSlot>& slots)
+{
+    int index = FindTransferred(transferred, message);
+    if (index >= 0) {
+        slots.push_back({ "", static_cast<size_t>(index), true });
+        *stripped = JS_UNDEFINED;
+        return true;
+    }
+    *stripped = JS_DupValue(context_, message);
+    bool isArray = JS_IsArray(context_, message) > 0;
+    if (!isArray && !IsPlainObject(message)) {
+        return true;
+    }
+
+    JSPropertyEnum* props = nullptr;
+    uint32_t propCount = 0;
+    if (JS_GetOwnPropertyNames(context_, &props, &propCount, message, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY) < 0) {
+        return false;
+    }
+    std::vector<JSValue> values(propCount, JS_UNDEFINED);
+    size_t slotCount = slots.size();
+    bool result = true;
+    for (uint32_t i = 0; i < propCount; i++) {
+        values[i] = JS_GetProperty(context_, message, props[i].atom);
+        if (JS_IsException(values[i])) {
+            result = false;
+            break;
+        }
+        index = FindTransferred(transferred, values[i]);
+        if (index < 0) {
+            continue;
+        }
+        const char* key = JS_AtomToCString(context_, props[i].atom);
+        if (key == nullptr) {
+            result = false;
+            break;
+        }
+        slots.push_back({ key, static_cast<size_t>(index), false });
+        JS_FreeCString(context_, key);
+        JS_FreeValue(context_, values[i]);
+        values[i] = JS_UNDEFINED;
+    }
+
+    // Only copy the message when one of its properties is transferred
+    if (result && slots.size() > slotCount) {
+        JSValue copy = isArray ? JS_NewArray(context_) : JS_NewObject(context_);
+        for (uint32_t i = 0; i < propCount; i++) {
+            JS_SetProperty(context_, copy, props[i].atom, values[i]);
+            values[i] = JS_UNDEFINED;
+        }
+        if (isArray) {
+            JS_SetPropertyStr(context_, copy, "length", JS_GetPropertyStr(context_, message, "length"));
+        }
+        JS_FreeValue(context_, *stripped);
+        *stripped = copy;
+    }
+    for (uint32_t i = 0; i < propCount; i++) {
+        JS_FreeValue(context_, values[i]);
+        JS_FreeAtom(context_, props[i].atom);
+    }
+    js_free(context_, props);
+    return result;
+}
+
 NativeValue* QuickJSNativeEngine::Serialize(NativeEngine* context, NativeValue* value, NativeValue* transfer)
 {
     if (!CheckTransferList(*transfer)) {
         return nullptr;
     }
+    std::vector<JSValue> transferred;
+    JSValue transferList = *transfer;
+    if (!JS_IsUndefined(transferList)) {
+        int64_t len = 0;
+        js_get_length64(context_, &len, transferList);
+        for (int64_t i = 0; i < len; i++) {
+            transferred.push_back(JS_GetPropertyInt64(context_, transferList, i));
+        }
+    }
+
+    // Top level transferred buffers leave the serialized bytes, their contents are copied once and passed by pointer
+    std::vector<SerializeData::TransferSlot> slots;
+    JSValue message = JS_UNDEFINED;
+    if (transferred.empty()) {
+        message = JS_DupValue(context_, *value);
+    } else if (!StripTransferred(*value, transferred, &message, slots)) {
+        JS_FreeValue(context_, message);
+        for (auto& buffer : transferred) {
+            JS_FreeValue(context_, buffer);
+        }
+        return nullptr;
+    }
     size_t dataLen;
-    uint8_t* data = JS_WriteObject(context_, &dataLen, *value, JS_WRITE_OBJ);
-    DetachTransferList(*transfer);
-    return reinterpret_cast<NativeValue*>(new SerializeData(dataLen, data));
+    uint8_t* data = JS_WriteObject(context_, &dataLen, message, JS_WRITE_OBJ);
+    JS_FreeValue(context_, message);
+    auto result = new SerializeData(dataLen, data);
+
+    auto& buffers = result->GetTransferredBuffers();
+    buffers.resize(transferred.size());
+    for (auto& slot : slots) {
+        auto& buffer = buffers[slot.buffer];
+        if (buffer.data != nullptr) {
+            continue;
+        }
+        size_t length = 0;
+        uint8_t* contents = JS_GetArrayBuffer(context_, &length, transferred[slot.buffer]);
+        if (contents == nullptr) {
+            // Already detached, the receiver gets an empty buffer
+            JS_FreeValue(context_, JS_GetException(context_));
+            continue;
+        }
+        if (length == 0) {
+            continue;
+        }
+        buffer.data = static_cast<uint8_t*>(malloc(length));
+        if (buffer.data == nullptr || memcpy_s(buffer.data, length, contents, length) != EOK) {
+            HILOG_ERROR("transfer array buffer failed");
+            free(buffer.data);
+            buffer.data = nullptr;
+            continue;
+        }
+        buffer.length = length;
+    }
+    result->GetTransferSlots() = std::move(slots);
+
+    DetachTransferList(transferList);
+    for (auto& buffer : transferred) {
+        JS_FreeValue(context_, buffer);
+    }
+    return reinterpret_cast<NativeValue*>(result);
 }
 
 NativeValue* QuickJSNativeEngine::Deserialize(NativeEngine* context, NativeValue* recorder)
 {
     auto data = reinterpret_cast<SerializeData*>(recorder);
     JSValue result = JS_ReadObject(context_, data->GetData(), data->GetSize(), JS_WRITE_OBJ);
+    if (JS_IsException(result)) {
+        return JSValueToNativeValue(this, result);
+    }
+
+    // Each transferred buffer is attached once, to the first slot holding it
+    auto& buffers = data->GetTransferredBuffers();
+    std::vector<JSValue> attached(buffers.size(), JS_UNDEFINED);
+    for (auto& slot : data->GetTransferSlots()) {
+        JSValue& arrayBuffer = attached[slot.buffer];
+        if (JS_IsUndefined(arrayBuffer)) {
+            auto& buffer = buffers[slot.buffer];
+            if (buffer.data != nullptr) {
+                arrayBuffer = JS_NewArrayBuffer(
+                    context_, buffer.data, buffer.length, FreeTransferredBuffer, nullptr, false);
+                if (JS_IsException(arrayBuffer)) {
+                    // The contents stay with the serialization data, the slot keeps undefined
+                    HILOG_ERROR("attach transferred array buffer failed");
+                    arrayBuffer = JS_UNDEFINED;
+                    continue;
+                }
+                buffer.data = nullptr;
+                buffer.length = 0;
+            } else {
+                arrayBuffer = JS_NewArrayBufferCopy(context_, nullptr, 0);
+            }
+        }
+        if (slot.isMessage) {
+            JS_FreeValue(context_, result);
+            result = JS_DupValue(context_, arrayBuffer);
+        } else {
+            JS_SetPropertyStr(context_, result, slot.key.c_str(), JS_DupValue(context_, arrayBuffer));
+        }
+    }
+    for (auto& arrayBuffer : attached) {
+        JS_FreeValue(context_, arrayBuffer);
+    }
     return JSValueToNativeValue(this, result);
 }
 
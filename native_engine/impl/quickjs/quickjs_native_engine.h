@@ -19,10 +19,29 @@
 #include "native_engine/native_engine.h"
 #include "quickjs_headers.h"
 
+class QuickJSBufferPool;
+
 class SerializeData {
 public:
+    // Contents of a transferred ArrayBuffer, malloc owned until the receiving engine attaches them
+    struct TransferredBuffer {
+        uint8_t* data = nullptr;
+        size_t length = 0;
+    };
+    // Property of the message, or the message itself, that receives a transferred buffer
+    struct TransferSlot {
+        std::string key;
+        size_t buffer = 0;
+        bool isMessage = false;
+    };
+
     SerializeData(size_t size, uint8_t* data) : dataSize_(size), value_(data) {}
-    ~SerializeData() = default;
+    ~SerializeData()
+    {
+        for (auto& buffer : transferredBuffers_) {
+            free(buffer.data);
+        }
+    }
 
     uint8_t* GetData() const
     {
@@ -33,6 +52,15 @@ public:
         return dataSize_;
     }
 
+    std::vector<TransferredBuffer>& GetTransferredBuffers()
+    {
+        return transferredBuffers_;
+    }
+    std::vector<TransferSlot>& GetTransferSlots()
+    {
+        return transferSlots_;
+    }
+
 private:
     struct Deleter {
         void operator()(uint8_t* ptr) const
@@ -43,6 +71,8 @@ private:
 
     size_t dataSize_;
     std::unique_ptr<uint8_t, Deleter> value_;
+    std::vector<TransferredBuffer> transferredBuffers_;
+    std::vector<TransferSlot> transferSlots_;
 };
 
 class QuickJSNativeEngine : public NativeEngine {
@@ -54,6 +84,7 @@ public:
     JSContext* GetContext();
 
     void Loop(LoopMode mode, bool needSync = false) override;
+    void RunMicrotasks(uint32_t budget = 0) override;
 
     NativeValue* GetGlobal() override;
     NativeValue* CreateNull() override;
@@ -67,12 +98,25 @@ public:
     NativeValue* CreateBigInt(uint64_t value) override;
     NativeValue* CreateString(const char* value, size_t length) override;
     NativeValue* CreateString16(const char16_t* value, size_t length) override;
+    NativePropertyKey* CreatePropertyKey(const char* name, size_t length) override;
     NativeValue* CreateSymbol(NativeValue* value) override;
     NativeValue* CreateExternal(void* value, NativeFinalize callback, void* hint) override;
 
     NativeValue* CreateObject() override;
+    NativeValue* CreateObjectWithProperties(
+        NativeValue* prototype, const char* const* names, NativeValue* const* values, size_t count) override;
+    NativeValue* CreateObjectFromTemplate(NativeObjectTemplate* objectTemplate, NativeValue* const* values) override;
     NativeValue* CreateFunction(const char* name, size_t length, NativeCallback cb, void* value) override;
     NativeValue* CreateArray(size_t length) override;
+    bool GetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue** result) override;
+    bool SetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue* const* values) override;
+    bool GetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, double* result) override;
+    bool GetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, int32_t* result) override;
+    bool GetElementsUtf8(
+        NativeValue* array, uint32_t start, uint32_t count, const char** result, size_t* lengths) override;
+    bool SetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, const double* values) override;
+    bool SetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, const int32_t* values) override;
+    bool GetObjectIdentityHash(NativeValue* object, uint32_t* hash) override;
 
     NativeValue* CreateArrayBuffer(void** value, size_t length) override;
     NativeValue* CreateArrayBufferExternal(void* value, size_t length, NativeFinalize cb, void* hint) override;
@@ -117,6 +161,12 @@ public:
     ExceptionInfo* GetExceptionForWorker() const override;
     NativeValue* LoadModule(NativeValue* str, const std::string& fileName) override;
 
+    // Intrinsic constructors captured at init, the returned value is borrowed.
+    // Later changes to the global object do not affect them.
+    JSValue GetTypedArrayConstructor(NativeTypedArrayType type) const;
+    JSValue GetDataViewConstructor() const;
+    QuickJSBufferPool* GetBufferPool() const;
+
     static NativeValue* JSValueToNativeValue(QuickJSNativeEngine* engine, JSValue value);
     NativeValue* ValueToNativeValue(JSValueWrapper& value) override;
     JSValue GetModuleFromName(
@@ -184,9 +234,19 @@ public:
 
 private:
     static NativeEngine* CreateRuntimeFunc(NativeEngine* engine, void* jsEngine);
+    void InitIntrinsicConstructors();
+    void FreeIntrinsicConstructors();
+    bool IsPlainObject(JSValueConst value);
+    bool StripTransferred(JSValueConst message, const std::vector<JSValue>& transferred, JSValue* stripped,
+        std::vector<SerializeData::TransferSlot>& slots);
+
+    static constexpr size_t TYPED_ARRAY_TYPE_COUNT = NATIVE_BIGUINT64_ARRAY + 1;
 
     JSRuntime* runtime_;
     JSContext* context_;
+    JSValue typedArrayConstructors_[TYPED_ARRAY_TYPE_COUNT];
+    JSValue dataViewConstructor_;
+    QuickJSBufferPool* bufferPool_;
 };
 
 #endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_IMPL_QUICKJS_QUICKJS_NATIVE_ENGINE_H */
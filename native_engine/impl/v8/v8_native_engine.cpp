@@ -36,6 +36,41 @@
 
 static thread_local V8NativeEngine* g_env = nullptr;
 
+template<typename Resource, typename Char>
+class V8ExternalStringResource : public Resource {
+public:
+    V8ExternalStringResource(NativeEngine* engine, Char* data, size_t length, NativeFinalize cb, void* hint)
+        : engine_(engine), data_(data), length_(length), cb_(cb), hint_(hint)
+    {}
+    ~V8ExternalStringResource() override = default;
+
+    const Char* data() const override
+    {
+        return data_;
+    }
+    size_t length() const override
+    {
+        return length_;
+    }
+    void Dispose() override
+    {
+        if (cb_ != nullptr) {
+            cb_(engine_, data_, hint_);
+        }
+        delete this;
+    }
+
+private:
+    NativeEngine* engine_;
+    Char* data_;
+    size_t length_;
+    NativeFinalize cb_;
+    void* hint_;
+};
+
+using V8ExternalOneByteString = V8ExternalStringResource<v8::String::ExternalOneByteStringResource, char>;
+using V8ExternalTwoByteString = V8ExternalStringResource<v8::String::ExternalStringResource, uint16_t>;
+
 V8NativeEngine::V8NativeEngine(v8::Platform* platform, v8::Isolate* isolate,
     v8::Persistent<v8::Context>& context, void* jsEngine)
     : NativeEngine(jsEngine),
@@ -297,6 +332,37 @@ NativeValue* V8NativeEngine::CreateString(const char* value, size_t length)
     return new V8NativeString(this, value, length);
 }
 
+NativeValue* V8NativeEngine::CreateStringLatin1(const char* value, size_t length)
+{
+    v8::Local<v8::String> str = v8::String::NewFromOneByte(isolate_, reinterpret_cast<const uint8_t*>(value),
+        v8::NewStringType::kNormal, length).ToLocalChecked();
+    return new V8NativeString(this, str);
+}
+
+NativeValue* V8NativeEngine::CreateExternalString(char* value, size_t length, NativeFinalize cb, void* hint,
+    bool* copied)
+{
+    auto resource = new V8ExternalOneByteString(this, value, length, cb, hint);
+    v8::Local<v8::String> str;
+    if (!v8::String::NewExternalOneByte(isolate_, resource).ToLocal(&str)) {
+        delete resource;
+        return NativeEngine::CreateExternalString(value, length, cb, hint, copied);
+    }
+    return new V8NativeString(this, str);
+}
+
+NativeValue* V8NativeEngine::CreateExternalString(char16_t* value, size_t length, NativeFinalize cb, void* hint,
+    bool* copied)
+{
+    auto resource = new V8ExternalTwoByteString(this, reinterpret_cast<uint16_t*>(value), length, cb, hint);
+    v8::Local<v8::String> str;
+    if (!v8::String::NewExternalTwoByte(isolate_, resource).ToLocal(&str)) {
+        delete resource;
+        return NativeEngine::CreateExternalString(value, length, cb, hint, copied);
+    }
+    return new V8NativeString(this, str);
+}
+
 NativeValue* V8NativeEngine::CreateSymbol(NativeValue* value)
 {
     return new V8NativeValue(this, v8::Symbol::New(isolate_, *value));
@@ -119,6 +119,13 @@ public:
     NativeValue* CreateNumber(double value) override;
     // Create native string value by const char pointer
     NativeValue* CreateString(const char* value, size_t length) override;
+    // Create native one-byte string value by Latin-1 bytes
+    NativeValue* CreateStringLatin1(const char* value, size_t length) override;
+    // Create native string value referencing external memory
+    NativeValue* CreateExternalString(char* value, size_t length, NativeFinalize cb, void* hint,
+        bool* copied) override;
+    NativeValue* CreateExternalString(char16_t* value, size_t length, NativeFinalize cb, void* hint,
+        bool* copied) override;
     // Create native symbol value
     NativeValue* CreateSymbol(NativeValue* value) override;
     // Create native value of external pointer
@@ -16,6 +16,13 @@
 #define NAPI_EXPERIMENTAL
 #endif
 
+#if !defined(WINDOWS_PLATFORM)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "native_api_internal.h"
 #include "native_engine/native_property.h"
 #include "native_engine/native_value.h"
@@ -175,7 +182,7 @@ NAPI_EXTERN napi_status napi_create_string_latin1(napi_env env, const char* str,
     CHECK_ARG(env, result);
 
     auto engine = reinterpret_cast<NativeEngine*>(env);
-    auto resultValue = engine->CreateString(str, (length == NAPI_AUTO_LENGTH) ? strlen(str) : length);
+    auto resultValue = engine->CreateStringLatin1(str, (length == NAPI_AUTO_LENGTH) ? strlen(str) : length);
 
     *result = reinterpret_cast<napi_value>(resultValue);
     return napi_clear_last_error(env);
@@ -202,8 +209,10 @@ NAPI_INNER_EXTERN napi_status napi_create_string_utf16(
     CHECK_ARG(env, result);
     RETURN_STATUS_IF_FALSE(env, (length == NAPI_AUTO_LENGTH) || (length <= INT_MAX && length > 0), napi_invalid_arg);
     auto engine = reinterpret_cast<NativeEngine*>(env);
-    int char16Length = static_cast<int>(std::char_traits<char16_t>::length(str));
-    auto resultValue = engine->CreateString16(str, (length == NAPI_AUTO_LENGTH) ? char16Length : length);
+    if (length == NAPI_AUTO_LENGTH) {
+        length = std::char_traits<char16_t>::length(str);
+    }
+    auto resultValue = engine->CreateString16(str, length);
 
     *result = reinterpret_cast<napi_value>(resultValue);
     return napi_clear_last_error(env);
@@ -937,7 +946,7 @@ NAPI_EXTERN napi_status napi_get_cb_info(napi_env env,              // [in] NAPI
     if ((argc != nullptr) && (argv != nullptr)) {
         size_t i = 0;
         for (i = 0; (i < *argc) && (i < info->argc); i++) {
-            argv[i] = reinterpret_cast<napi_value>(info->argv[i]);
+            argv[i] = reinterpret_cast<napi_value>(info->GetArgument(i));
         }
         *argc = i;
     }
@@ -947,7 +956,7 @@ NAPI_EXTERN napi_status napi_get_cb_info(napi_env env,              // [in] NAPI
     }
 
     if (this_arg != nullptr) {
-        *this_arg = reinterpret_cast<napi_value>(info->thisVar);
+        *this_arg = reinterpret_cast<napi_value>(info->GetThis());
     }
 
     if (data != nullptr && info->functionInfo != nullptr) {
@@ -965,8 +974,10 @@ NAPI_EXTERN napi_status napi_get_new_target(napi_env env, napi_callback_info cbi
 
     auto info = reinterpret_cast<NativeCallbackInfo*>(cbinfo);
 
-    if (info->thisVar->InstanceOf(info->function)) {
-        *result = reinterpret_cast<napi_value>(info->function);
+    NativeValue* thisVar = info->GetThis();
+    NativeValue* newTarget = info->GetNewTarget();
+    if (thisVar != nullptr && newTarget != nullptr && thisVar->InstanceOf(newTarget)) {
+        *result = reinterpret_cast<napi_value>(newTarget);
     } else {
         *result = nullptr;
     }
@@ -2372,3 +2383,497 @@ NAPI_EXTERN napi_status napi_run_script_path(napi_env env, const char* path, nap
     *result = reinterpret_cast<napi_value>(resultValue);
     return napi_clear_last_error(env);
 }
+
+NAPI_EXTERN napi_status napi_get_value_string_utf8_view(napi_env env,
+                                                        napi_value value,
+                                                        const char** result,
+                                                        size_t* length)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, value);
+    CHECK_ARG(env, result);
+    CHECK_ARG(env, length);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto nativeValue = reinterpret_cast<NativeValue*>(value);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->TypeOf() == NATIVE_STRING, napi_string_expected);
+
+    auto nativeString = reinterpret_cast<NativeString*>(nativeValue->GetInterface(NativeString::INTERFACE_ID));
+
+    if (nativeString->GetCStringView(result, length)) {
+        return napi_clear_last_error(env);
+    }
+
+    // engine can not lend its buffer, copy into memory owned by the current scope
+    size_t size = 0;
+    nativeString->GetCString(nullptr, 0, &size);
+    auto buffer = static_cast<char*>(engine->GetScopeManager()->Allocate(size + 1));
+    RETURN_STATUS_IF_FALSE(env, buffer != nullptr, napi_generic_failure);
+    nativeString->GetCString(buffer, size + 1, length);
+    *result = buffer;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_create_external_string_latin1(napi_env env,
+                                                           char* str,
+                                                           size_t length,
+                                                           napi_finalize finalize_callback,
+                                                           void* finalize_hint,
+                                                           napi_value* result,
+                                                           bool* copied)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, str);
+    CHECK_ARG(env, result);
+    RETURN_STATUS_IF_FALSE(env, (length == NAPI_AUTO_LENGTH) || (length <= INT_MAX), napi_invalid_arg);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto callback = reinterpret_cast<NativeFinalize>(finalize_callback);
+    if (copied != nullptr) {
+        *copied = false;
+    }
+    auto resultValue = engine->CreateExternalString(
+        str, (length == NAPI_AUTO_LENGTH) ? strlen(str) : length, callback, finalize_hint, copied);
+    RETURN_STATUS_IF_FALSE(env, resultValue != nullptr, napi_generic_failure);
+
+    *result = reinterpret_cast<napi_value>(resultValue);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_create_external_string_utf16(napi_env env,
+                                                          char16_t* str,
+                                                          size_t length,
+                                                          napi_finalize finalize_callback,
+                                                          void* finalize_hint,
+                                                          napi_value* result,
+                                                          bool* copied)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, str);
+    CHECK_ARG(env, result);
+    RETURN_STATUS_IF_FALSE(env, (length == NAPI_AUTO_LENGTH) || (length <= INT_MAX), napi_invalid_arg);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto callback = reinterpret_cast<NativeFinalize>(finalize_callback);
+    if (length == NAPI_AUTO_LENGTH) {
+        length = std::char_traits<char16_t>::length(str);
+    }
+    if (copied != nullptr) {
+        *copied = false;
+    }
+    auto resultValue = engine->CreateExternalString(str, length, callback, finalize_hint, copied);
+    RETURN_STATUS_IF_FALSE(env, resultValue != nullptr, napi_generic_failure);
+
+    *result = reinterpret_cast<napi_value>(resultValue);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_create_property_key(napi_env env, const char* utf8name, napi_property_key* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, utf8name);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto key = engine->CreatePropertyKey(utf8name, strlen(utf8name));
+    RETURN_STATUS_IF_FALSE(env, key != nullptr, napi_generic_failure);
+
+    *result = reinterpret_cast<napi_property_key>(key);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_delete_property_key(napi_env env, napi_property_key key)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, key);
+
+    auto nativePropertyKey = reinterpret_cast<NativePropertyKey*>(key);
+    delete nativePropertyKey;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_property_by_key(napi_env env,
+                                                 napi_value object,
+                                                 napi_property_key key,
+                                                 napi_value* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, object);
+    CHECK_ARG(env, key);
+    CHECK_ARG(env, result);
+
+    auto nativeValue = reinterpret_cast<NativeValue*>(object);
+    auto nativePropertyKey = reinterpret_cast<NativePropertyKey*>(key);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->TypeOf() == NATIVE_OBJECT || nativeValue->TypeOf() == NATIVE_FUNCTION,
+        napi_object_expected);
+
+    auto nativeObject = reinterpret_cast<NativeObject*>(nativeValue->GetInterface(NativeObject::INTERFACE_ID));
+
+    auto resultValue = nativeObject->GetProperty(nativePropertyKey);
+
+    *result = reinterpret_cast<napi_value>(resultValue);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_set_property_by_key(napi_env env,
+                                                 napi_value object,
+                                                 napi_property_key key,
+                                                 napi_value value)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, object);
+    CHECK_ARG(env, key);
+    CHECK_ARG(env, value);
+
+    auto nativeValue = reinterpret_cast<NativeValue*>(object);
+    auto nativePropertyKey = reinterpret_cast<NativePropertyKey*>(key);
+    auto propValue = reinterpret_cast<NativeValue*>(value);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->TypeOf() == NATIVE_OBJECT || nativeValue->TypeOf() == NATIVE_FUNCTION,
+        napi_object_expected);
+
+    auto nativeObject = reinterpret_cast<NativeObject*>(nativeValue->GetInterface(NativeObject::INTERFACE_ID));
+
+    nativeObject->SetProperty(nativePropertyKey, propValue);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_elements(napi_env env,
+                                          napi_value array,
+                                          uint32_t start,
+                                          uint32_t count,
+                                          napi_value* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, array);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto nativeValue = reinterpret_cast<NativeValue*>(array);
+    auto nativeResult = reinterpret_cast<NativeValue**>(result);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->IsArray(), napi_array_expected);
+    RETURN_STATUS_IF_FALSE(env, count <= UINT32_MAX - start, napi_invalid_arg);
+    RETURN_STATUS_IF_FALSE(env, engine->GetElements(nativeValue, start, count, nativeResult), napi_generic_failure);
+
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_set_elements(napi_env env,
+                                          napi_value array,
+                                          uint32_t start,
+                                          uint32_t count,
+                                          const napi_value* values)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, array);
+    CHECK_ARG(env, values);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto nativeValue = reinterpret_cast<NativeValue*>(array);
+    auto nativeValues = reinterpret_cast<NativeValue* const*>(values);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->IsArray(), napi_array_expected);
+    RETURN_STATUS_IF_FALSE(env, count <= UINT32_MAX - start, napi_invalid_arg);
+    RETURN_STATUS_IF_FALSE(env, engine->SetElements(nativeValue, start, count, nativeValues), napi_generic_failure);
+
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_elements_double(napi_env env,
+                                                 napi_value array,
+                                                 uint32_t start,
+                                                 uint32_t count,
+                                                 double* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, array);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto nativeValue = reinterpret_cast<NativeValue*>(array);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->IsArray(), napi_array_expected);
+    RETURN_STATUS_IF_FALSE(env, count <= UINT32_MAX - start, napi_invalid_arg);
+    RETURN_STATUS_IF_FALSE(env, engine->GetElementsDouble(nativeValue, start, count, result), napi_number_expected);
+
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_elements_int32(napi_env env,
+                                                napi_value array,
+                                                uint32_t start,
+                                                uint32_t count,
+                                                int32_t* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, array);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto nativeValue = reinterpret_cast<NativeValue*>(array);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->IsArray(), napi_array_expected);
+    RETURN_STATUS_IF_FALSE(env, count <= UINT32_MAX - start, napi_invalid_arg);
+    RETURN_STATUS_IF_FALSE(env, engine->GetElementsInt32(nativeValue, start, count, result), napi_number_expected);
+
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_elements_string_utf8_view(napi_env env,
+                                                           napi_value array,
+                                                           uint32_t start,
+                                                           uint32_t count,
+                                                           const char** result,
+                                                           size_t* lengths)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, array);
+    CHECK_ARG(env, result);
+    CHECK_ARG(env, lengths);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto nativeValue = reinterpret_cast<NativeValue*>(array);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->IsArray(), napi_array_expected);
+    RETURN_STATUS_IF_FALSE(env, count <= UINT32_MAX - start, napi_invalid_arg);
+    RETURN_STATUS_IF_FALSE(env, engine->GetElementsUtf8(nativeValue, start, count, result, lengths),
+        napi_string_expected);
+
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_set_elements_double(napi_env env,
+                                                 napi_value array,
+                                                 uint32_t start,
+                                                 uint32_t count,
+                                                 const double* values)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, array);
+    CHECK_ARG(env, values);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto nativeValue = reinterpret_cast<NativeValue*>(array);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->IsArray(), napi_array_expected);
+    RETURN_STATUS_IF_FALSE(env, count <= UINT32_MAX - start, napi_invalid_arg);
+    RETURN_STATUS_IF_FALSE(env, engine->SetElementsDouble(nativeValue, start, count, values), napi_generic_failure);
+
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_set_elements_int32(napi_env env,
+                                                napi_value array,
+                                                uint32_t start,
+                                                uint32_t count,
+                                                const int32_t* values)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, array);
+    CHECK_ARG(env, values);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto nativeValue = reinterpret_cast<NativeValue*>(array);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->IsArray(), napi_array_expected);
+    RETURN_STATUS_IF_FALSE(env, count <= UINT32_MAX - start, napi_invalid_arg);
+    RETURN_STATUS_IF_FALSE(env, engine->SetElementsInt32(nativeValue, start, count, values), napi_generic_failure);
+
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_create_object_with_properties(napi_env env,
+                                                           napi_value prototype,
+                                                           const char** names,
+                                                           const napi_value* values,
+                                                           size_t count,
+                                                           napi_value* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+    if (count > 0) {
+        CHECK_ARG(env, names);
+        CHECK_ARG(env, values);
+    }
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto nativePrototype = reinterpret_cast<NativeValue*>(prototype);
+    auto nativeValues = reinterpret_cast<NativeValue* const*>(values);
+
+    if (nativePrototype != nullptr) {
+        NativeValueType type = nativePrototype->TypeOf();
+        RETURN_STATUS_IF_FALSE(env, type == NATIVE_OBJECT || type == NATIVE_FUNCTION || type == NATIVE_NULL,
+            napi_object_expected);
+    }
+    for (size_t i = 0; i < count; i++) {
+        CHECK_ARG(env, names[i]);
+        CHECK_ARG(env, values[i]);
+    }
+
+    auto resultValue = engine->CreateObjectWithProperties(nativePrototype, names, nativeValues, count);
+    RETURN_STATUS_IF_FALSE(env, resultValue != nullptr, napi_generic_failure);
+
+    *result = reinterpret_cast<napi_value>(resultValue);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_create_object_template(napi_env env,
+                                                    const char** names,
+                                                    size_t count,
+                                                    napi_object_template* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+    if (count > 0) {
+        CHECK_ARG(env, names);
+    }
+    for (size_t i = 0; i < count; i++) {
+        CHECK_ARG(env, names[i]);
+    }
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto objectTemplate = engine->CreateObjectTemplate(names, count);
+    RETURN_STATUS_IF_FALSE(env, objectTemplate != nullptr, napi_generic_failure);
+
+    *result = reinterpret_cast<napi_object_template>(objectTemplate);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_delete_object_template(napi_env env, napi_object_template object_template)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, object_template);
+
+    auto objectTemplate = reinterpret_cast<NativeObjectTemplate*>(object_template);
+    delete objectTemplate;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_new_object_from_template(napi_env env,
+                                                      napi_object_template object_template,
+                                                      const napi_value* values,
+                                                      napi_value* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, object_template);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto objectTemplate = reinterpret_cast<NativeObjectTemplate*>(object_template);
+    auto nativeValues = reinterpret_cast<NativeValue* const*>(values);
+
+    size_t count = objectTemplate->GetPropertyCount();
+    if (count > 0) {
+        CHECK_ARG(env, values);
+    }
+    for (size_t i = 0; i < count; i++) {
+        CHECK_ARG(env, values[i]);
+    }
+
+    auto resultValue = engine->CreateObjectFromTemplate(objectTemplate, nativeValues);
+    RETURN_STATUS_IF_FALSE(env, resultValue != nullptr, napi_generic_failure);
+
+    *result = reinterpret_cast<napi_value>(resultValue);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_object_identity_hash(napi_env env, napi_value object, uint32_t* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, object);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto nativeValue = reinterpret_cast<NativeValue*>(object);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->TypeOf() == NATIVE_OBJECT || nativeValue->TypeOf() == NATIVE_FUNCTION,
+        napi_object_expected);
+    RETURN_STATUS_IF_FALSE(env, engine->GetObjectIdentityHash(nativeValue, result), napi_generic_failure);
+
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_create_arraybuffer_from_file(napi_env env,
+                                                          const char* path,
+                                                          size_t offset,
+                                                          size_t length,
+                                                          napi_file_mapping_mode mode,
+                                                          napi_value* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, path);
+    CHECK_ARG(env, result);
+    RETURN_STATUS_IF_FALSE(env, mode == napi_file_mapping_copy_on_write, napi_invalid_arg);
+
+#if defined(WINDOWS_PLATFORM)
+    HILOG_ERROR("file mapping is not supported on this platform");
+    return napi_set_last_error(env, napi_generic_failure);
+#else
+    struct FileMapping {
+        void* address = nullptr;
+        size_t size = 0;
+    };
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+
+    // O_NONBLOCK keeps a FIFO from blocking the open, anything but a regular file is rejected below
+    int fd = open(path, O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+    if (fd < 0) {
+        HILOG_ERROR("open %{public}s failed", path);
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0) {
+        close(fd);
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+    if (!S_ISREG(fileStat.st_mode)) {
+        close(fd);
+        return napi_set_last_error(env, napi_invalid_arg);
+    }
+    size_t fileSize = static_cast<size_t>(fileStat.st_size);
+    if (offset > fileSize || (length == 0 && offset == fileSize) || (length > fileSize - offset)) {
+        close(fd);
+        return napi_set_last_error(env, napi_invalid_arg);
+    }
+    if (length == 0) {
+        length = fileSize - offset;
+    }
+
+    // mmap needs a page aligned offset, the ArrayBuffer starts inside the first page
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t mapOffset = offset - offset % pageSize;
+    size_t leading = offset - mapOffset;
+    // Copy on write, script can always write through a view and MAP_PRIVATE keeps those writes out of the file
+    void* address =
+        mmap(nullptr, length + leading, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, static_cast<off_t>(mapOffset));
+    close(fd);
+    if (address == MAP_FAILED) {
+        HILOG_ERROR("mmap %{public}s failed", path);
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+
+    auto mapping = new FileMapping();
+    mapping->address = address;
+    mapping->size = length + leading;
+    auto resultValue = engine->CreateArrayBufferExternal(
+        static_cast<uint8_t*>(address) + leading, length,
+        [](NativeEngine* engine, void* data, void* hint) {
+            auto mapping = reinterpret_cast<FileMapping*>(hint);
+            munmap(mapping->address, mapping->size);
+            delete mapping;
+        },
+        mapping);
+    if (resultValue == nullptr) {
+        munmap(address, length + leading);
+        delete mapping;
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+
+    *result = reinterpret_cast<napi_value>(resultValue);
+    return napi_clear_last_error(env);
+#endif
+}
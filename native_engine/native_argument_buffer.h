@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ARGUMENT_BUFFER_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ARGUMENT_BUFFER_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+/*
+ * Argument storage for a single call.
+ * Up to INLINE_SIZE entries live inside the object, larger counts take one heap array that is freed with the
+ * buffer, so the memory never outlives the call. Entries start value-initialized.
+ * Data() is nullptr if the heap allocation fails.
+ */
+template<typename T, size_t INLINE_SIZE = 8>
+class NativeArgumentBuffer {
+public:
+    explicit NativeArgumentBuffer(size_t count)
+    {
+        if (count <= INLINE_SIZE) {
+            data_ = inline_;
+            return;
+        }
+        heap_.reset(new (std::nothrow) T[count]());
+        data_ = heap_.get();
+    }
+    ~NativeArgumentBuffer() = default;
+
+    NativeArgumentBuffer(const NativeArgumentBuffer&) = delete;
+    NativeArgumentBuffer& operator=(const NativeArgumentBuffer&) = delete;
+
+    T* Data() const
+    {
+        return data_;
+    }
+
+    T& operator[](size_t index)
+    {
+        return data_[index];
+    }
+
+private:
+    T inline_[INLINE_SIZE] {};
+    std::unique_ptr<T[]> heap_;
+    T* data_ = nullptr;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ARGUMENT_BUFFER_H */
@@ -18,9 +18,11 @@
 #if !defined(WINDOWS_PLATFORM) && !defined(MAC_PLATFORM) && !defined(IOS_PLATFORM)
 #include <sys/epoll.h>
 #endif
+#include <cstring>
 #include <uv.h>
 
 #include "utils/log.h"
+#include "utils/unicode.h"
 
 namespace {
 const char* g_errorMessages[] = {
@@ -46,8 +48,74 @@ const char* g_errorMessages[] = {
     "Need arraybuffer",
     "Need detachable arraybuffer",
 };
+
+constexpr char IDENTITY_HASH_KEY[] = "_napiidentityhash";
+
+// Identity hashes are unique, a value equal to the prototype's one was inherited from it
+bool GetOwnIdentityHash(NativeObject* nativeObject, uint32_t* hash)
+{
+    if (!nativeObject->HasProperty(IDENTITY_HASH_KEY)) {
+        return false;
+    }
+    NativeValue* value = nativeObject->GetProperty(IDENTITY_HASH_KEY);
+    if (value == nullptr || value->TypeOf() != NATIVE_NUMBER) {
+        return false;
+    }
+    NativeValue* prototype = nativeObject->GetPrototype();
+    auto nativePrototype = (prototype != nullptr) ?
+        reinterpret_cast<NativeObject*>(prototype->GetInterface(NativeObject::INTERFACE_ID)) : nullptr;
+    if (nativePrototype != nullptr && nativePrototype->HasProperty(IDENTITY_HASH_KEY)) {
+        NativeValue* inherited = nativePrototype->GetProperty(IDENTITY_HASH_KEY);
+        if (inherited != nullptr && inherited->StrictEquals(value)) {
+            return false;
+        }
+    }
+    *hash = *reinterpret_cast<NativeNumber*>(value->GetInterface(NativeNumber::INTERFACE_ID));
+    return true;
+}
 } // namespace
 
+NativeValue* NativeCallbackInfo::GetArgument(size_t index)
+{
+    if (argv[index] == nullptr) {
+        argv[index] = Wrap(index);
+    }
+    return argv[index];
+}
+
+NativeValue* NativeCallbackInfo::GetThis()
+{
+    if (thisVar == nullptr) {
+        thisVar = Wrap(THIS_INDEX);
+    }
+    return thisVar;
+}
+
+NativeValue* NativeCallbackInfo::GetNewTarget()
+{
+    if (function == nullptr && !newTargetWrapped) {
+        function = Wrap(NEW_TARGET_INDEX);
+        newTargetWrapped = true;
+    }
+    return function;
+}
+
+NativeValue* NativeCallbackInfo::Wrap(size_t index)
+{
+    if (wrapper == nullptr || functionInfo == nullptr || functionInfo->engine == nullptr) {
+        return nullptr;
+    }
+    // The wrapper is cached for the whole call, so it must not land in a scope the callback opened itself
+    NativeScopeManager* scopeManager = functionInfo->engine->GetScopeManager();
+    if (scopeManager == nullptr) {
+        return nullptr;
+    }
+    NativeScope* previous = scopeManager->SwitchScope(scope);
+    NativeValue* value = wrapper(this, index);
+    scopeManager->SwitchScope(previous);
+    return value;
+}
+
 NativeEngine::NativeEngine(void* jsEngine) : jsEngine_(jsEngine) {}
 
 void NativeEngine::Init()
@@ -75,6 +143,10 @@ NativeEngine::~NativeEngine()
 
 void NativeEngine::Deinit()
 {
+    for (auto& entry : identityHashTable_) {
+        delete entry.first;
+    }
+    identityHashTable_.clear();
     if (referenceManager_ != nullptr) {
         delete referenceManager_;
         referenceManager_ = nullptr;
@@ -146,6 +218,32 @@ void NativeEngine::Loop(LoopMode mode, bool needSync)
     }
 }
 
+void NativeEngine::SetMicrotaskPolicy(MicrotaskPolicy policy, uint32_t jobBudget)
+{
+    microtaskPolicy_ = policy;
+    microtaskJobBudget_ = jobBudget;
+}
+
+void NativeEngine::MicrotaskCheckpoint()
+{
+    switch (microtaskPolicy_) {
+        case MICROTASK_SCOPED:
+            if (callbackScopeManager_ != nullptr && callbackScopeManager_->GetAsyncCallbackScopeDepth() > 0) {
+                callbackScopeManager_->MarkCheckpointPending();
+                return;
+            }
+            RunMicrotasks();
+            break;
+        case MICROTASK_BATCHED:
+            // drained by Loop at the end of the tick
+            break;
+        case MICROTASK_IMMEDIATE:
+        default:
+            RunMicrotasks();
+            break;
+    }
+}
+
 NativeAsyncWork* NativeEngine::CreateAsyncWork(NativeValue* asyncResource, NativeValue* asyncResourceName,
     NativeAsyncExecuteCallback execute, NativeAsyncCompleteCallback complete, void* data)
 {
@@ -229,6 +327,254 @@ NativeValue* NativeEngine::GetAndClearLastException()
     return temp;
 }
 
+NativeValue* NativeEngine::CreateStringLatin1(const char* value, size_t length)
+{
+    if (Unicode::AsciiPrefixLength(value, length) == length) {
+        return CreateString(value, length);
+    }
+    std::string str(Unicode::Latin1ToUtf8Length(value, length), '\0');
+    size_t strLength = Unicode::Latin1ToUtf8(value, length, &str[0], str.size());
+    return CreateString(str.c_str(), strLength);
+}
+
+NativeValue* NativeEngine::CreateExternalString(char* value, size_t length, NativeFinalize cb, void* hint,
+    bool* copied)
+{
+    NativeValue* result = CreateStringLatin1(value, length);
+    if (result == nullptr) {
+        return nullptr;
+    }
+    if (copied != nullptr) {
+        *copied = true;
+    }
+    if (cb != nullptr) {
+        cb(this, value, hint);
+    }
+    return result;
+}
+
+NativeValue* NativeEngine::CreateExternalString(char16_t* value, size_t length, NativeFinalize cb, void* hint,
+    bool* copied)
+{
+    NativeValue* result = CreateString16(value, length);
+    if (result == nullptr) {
+        return nullptr;
+    }
+    if (copied != nullptr) {
+        *copied = true;
+    }
+    if (cb != nullptr) {
+        cb(this, value, hint);
+    }
+    return result;
+}
+
+NativePropertyKey* NativeEngine::CreatePropertyKey(const char* name, size_t length)
+{
+    return new NativePropertyKey(name, length);
+}
+
+NativeObjectTemplate* NativeEngine::CreateObjectTemplate(const char* const* names, size_t count)
+{
+    std::vector<std::unique_ptr<NativePropertyKey>> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        NativePropertyKey* key = CreatePropertyKey(names[i], strlen(names[i]));
+        if (key == nullptr) {
+            return nullptr;
+        }
+        keys.emplace_back(key);
+    }
+    return new NativeObjectTemplate(std::move(keys));
+}
+
+NativeValue* NativeEngine::CreateObjectWithProperties(
+    NativeValue* prototype, const char* const* names, NativeValue* const* values, size_t count)
+{
+    NativeValue* result = nullptr;
+    if (prototype == nullptr) {
+        result = CreateObject();
+    } else {
+        auto global = reinterpret_cast<NativeObject*>(GetGlobal()->GetInterface(NativeObject::INTERFACE_ID));
+        NativeValue* objectCtor = global->GetProperty("Object");
+        auto objectCtorObj = reinterpret_cast<NativeObject*>(objectCtor->GetInterface(NativeObject::INTERFACE_ID));
+        result = CallFunction(objectCtor, objectCtorObj->GetProperty("create"), &prototype, 1);
+    }
+    if (result == nullptr || result->TypeOf() != NATIVE_OBJECT) {
+        return nullptr;
+    }
+    auto object = reinterpret_cast<NativeObject*>(result->GetInterface(NativeObject::INTERFACE_ID));
+    for (size_t i = 0; i < count; i++) {
+        NativePropertyDescriptor descriptor;
+        descriptor.utf8name = names[i];
+        descriptor.value = values[i];
+        descriptor.attributes = NATIVE_DEFAULT_PROPERTY;
+        if (!object->DefineProperty(descriptor)) {
+            return nullptr;
+        }
+    }
+    return result;
+}
+
+NativeValue* NativeEngine::CreateObjectFromTemplate(NativeObjectTemplate* objectTemplate, NativeValue* const* values)
+{
+    size_t count = objectTemplate->GetPropertyCount();
+    std::vector<const char*> names(count);
+    for (size_t i = 0; i < count; i++) {
+        names[i] = objectTemplate->GetPropertyKey(i)->GetName();
+    }
+    return CreateObjectWithProperties(nullptr, names.data(), values, count);
+}
+
+bool NativeEngine::GetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue** result)
+{
+    auto nativeArray = reinterpret_cast<NativeArray*>(array->GetInterface(NativeArray::INTERFACE_ID));
+    for (uint32_t i = 0; i < count; i++) {
+        result[i] = nativeArray->GetElement(start + i);
+    }
+    return true;
+}
+
+bool NativeEngine::SetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue* const* values)
+{
+    auto nativeArray = reinterpret_cast<NativeArray*>(array->GetInterface(NativeArray::INTERFACE_ID));
+    for (uint32_t i = 0; i < count; i++) {
+        if (!nativeArray->SetElement(start + i, values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool NativeEngine::GetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, double* result)
+{
+    auto nativeArray = reinterpret_cast<NativeArray*>(array->GetInterface(NativeArray::INTERFACE_ID));
+    for (uint32_t i = 0; i < count; i++) {
+        NativeValue* element = nativeArray->GetElement(start + i);
+        if (element == nullptr || element->TypeOf() != NATIVE_NUMBER) {
+            return false;
+        }
+        result[i] = *reinterpret_cast<NativeNumber*>(element->GetInterface(NativeNumber::INTERFACE_ID));
+    }
+    return true;
+}
+
+bool NativeEngine::GetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, int32_t* result)
+{
+    auto nativeArray = reinterpret_cast<NativeArray*>(array->GetInterface(NativeArray::INTERFACE_ID));
+    for (uint32_t i = 0; i < count; i++) {
+        NativeValue* element = nativeArray->GetElement(start + i);
+        if (element == nullptr || element->TypeOf() != NATIVE_NUMBER) {
+            return false;
+        }
+        result[i] = *reinterpret_cast<NativeNumber*>(element->GetInterface(NativeNumber::INTERFACE_ID));
+    }
+    return true;
+}
+
+bool NativeEngine::GetElementsUtf8(
+    NativeValue* array, uint32_t start, uint32_t count, const char** result, size_t* lengths)
+{
+    auto nativeArray = reinterpret_cast<NativeArray*>(array->GetInterface(NativeArray::INTERFACE_ID));
+    for (uint32_t i = 0; i < count; i++) {
+        NativeValue* element = nativeArray->GetElement(start + i);
+        if (element == nullptr || element->TypeOf() != NATIVE_STRING) {
+            return false;
+        }
+        auto nativeString = reinterpret_cast<NativeString*>(element->GetInterface(NativeString::INTERFACE_ID));
+        if (nativeString->GetCStringView(&result[i], &lengths[i])) {
+            continue;
+        }
+        size_t size = 0;
+        nativeString->GetCString(nullptr, 0, &size);
+        auto buffer = static_cast<char*>(GetScopeManager()->Allocate(size + 1));
+        if (buffer == nullptr) {
+            return false;
+        }
+        nativeString->GetCString(buffer, size + 1, &lengths[i]);
+        result[i] = buffer;
+    }
+    return true;
+}
+
+bool NativeEngine::SetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, const double* values)
+{
+    auto nativeArray = reinterpret_cast<NativeArray*>(array->GetInterface(NativeArray::INTERFACE_ID));
+    for (uint32_t i = 0; i < count; i++) {
+        if (!nativeArray->SetElement(start + i, CreateNumber(values[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool NativeEngine::SetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, const int32_t* values)
+{
+    auto nativeArray = reinterpret_cast<NativeArray*>(array->GetInterface(NativeArray::INTERFACE_ID));
+    for (uint32_t i = 0; i < count; i++) {
+        if (!nativeArray->SetElement(start + i, CreateNumber(values[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool NativeEngine::GetObjectIdentityHash(NativeValue* object, uint32_t* hash)
+{
+    // Engines without an identity hash number each object on first use. The number is kept in a non-enumerable,
+    // read-only own property, objects that cannot take one are looked up in a table of weak references instead.
+    auto nativeObject = reinterpret_cast<NativeObject*>(object->GetInterface(NativeObject::INTERFACE_ID));
+    if (nativeObject == nullptr) {
+        return false;
+    }
+    if (GetOwnIdentityHash(nativeObject, hash)) {
+        return true;
+    }
+
+    uint32_t next = identityHashSeed_ + 1;
+    NativePropertyDescriptor descriptor;
+    descriptor.utf8name = IDENTITY_HASH_KEY;
+    descriptor.value = CreateNumber(next);
+    descriptor.attributes = NATIVE_DEFAULT;
+    if (nativeObject->DefineProperty(descriptor)) {
+        identityHashSeed_ = next;
+        *hash = next;
+        return true;
+    }
+
+    // Frozen, sealed or otherwise non-extensible. The wrappers made while searching go with a scope of their own.
+    NativeScope* scope = scopeManager_->Open();
+    bool found = false;
+    for (auto entry = identityHashTable_.begin(); entry != identityHashTable_.end();) {
+        NativeValue* value = entry->first->Get();
+        if (value == nullptr || value->TypeOf() == NATIVE_UNDEFINED) {
+            // Collected, its number is never handed out again
+            delete entry->first;
+            entry = identityHashTable_.erase(entry);
+            continue;
+        }
+        if (value->StrictEquals(object)) {
+            *hash = entry->second;
+            found = true;
+            break;
+        }
+        ++entry;
+    }
+    scopeManager_->Close(scope);
+    if (found) {
+        return true;
+    }
+
+    NativeReference* reference = CreateReference(object, 0);
+    if (reference == nullptr) {
+        return false;
+    }
+    identityHashSeed_ = next;
+    identityHashTable_.emplace_back(reference, next);
+    *hash = next;
+    return true;
+}
+
 void NativeEngine::EncodeToUtf8(NativeValue* nativeValue,
                                 char* buffer,
                                 int32_t* written,
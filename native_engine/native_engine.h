@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "callback_scope_manager/native_callback_scope_manager.h"
@@ -64,6 +65,16 @@ enum DumpFormat {
     JSON, BINARY, OTHER
 };
 
+// When pending jobs queued by a JS call are drained
+enum MicrotaskPolicy {
+    // after every CallFunction/RunScript
+    MICROTASK_IMMEDIATE,
+    // once, when the outermost callback scope closes
+    MICROTASK_SCOPED,
+    // at the end of each loop tick, up to the configured job budget
+    MICROTASK_BATCHED,
+};
+
 class CleanupHookCallback {
 public:
     using Callback = void (*)(void*);
@@ -133,13 +144,41 @@ public:
     virtual NativeValue* CreateBigInt(uint64_t value) = 0;
     virtual NativeValue* CreateString(const char* value, size_t length) = 0;
     virtual NativeValue* CreateString16(const char16_t* value, size_t length) = 0;
+    // Engines without a one-byte constructor get the Latin-1 bytes transcoded to UTF-8
+    virtual NativeValue* CreateStringLatin1(const char* value, size_t length);
+    // Wrap caller-owned Latin-1 or UTF-16 memory, cb releases it once the engine no longer needs it.
+    // Engines that can't reference native memory copy it, set copied and call cb before returning.
+    virtual NativeValue* CreateExternalString(char* value, size_t length, NativeFinalize cb, void* hint, bool* copied);
+    virtual NativeValue* CreateExternalString(char16_t* value, size_t length, NativeFinalize cb, void* hint,
+        bool* copied);
+
+    // Resolve a property name once for repeated lookups, the caller deletes the key before the engine goes away
+    virtual NativePropertyKey* CreatePropertyKey(const char* name, size_t length);
+    NativeObjectTemplate* CreateObjectTemplate(const char* const* names, size_t count);
 
     virtual NativeValue* CreateSymbol(NativeValue* value) = 0;
     virtual NativeValue* CreateExternal(void* value, NativeFinalize callback, void* hint) = 0;
 
     virtual NativeValue* CreateObject() = 0;
+    // Like an object literal, values become own enumerable data properties. A null prototype means Object.prototype
+    virtual NativeValue* CreateObjectWithProperties(
+        NativeValue* prototype, const char* const* names, NativeValue* const* values, size_t count);
+    // values holds one entry per template property, in template order
+    virtual NativeValue* CreateObjectFromTemplate(NativeObjectTemplate* objectTemplate, NativeValue* const* values);
     virtual NativeValue* CreateFunction(const char* name, size_t length, NativeCallback cb, void* value) = 0;
     virtual NativeValue* CreateArray(size_t length) = 0;
+    // Bulk element access on arrays, the typed variants fail on the first element of another type.
+    // Strings are copied into memory owned by the current scope.
+    virtual bool GetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue** result);
+    virtual bool SetElements(NativeValue* array, uint32_t start, uint32_t count, NativeValue* const* values);
+    virtual bool GetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, double* result);
+    virtual bool GetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, int32_t* result);
+    virtual bool GetElementsUtf8(
+        NativeValue* array, uint32_t start, uint32_t count, const char** result, size_t* lengths);
+    virtual bool SetElementsDouble(NativeValue* array, uint32_t start, uint32_t count, const double* values);
+    virtual bool SetElementsInt32(NativeValue* array, uint32_t start, uint32_t count, const int32_t* values);
+    // Stays the same for the lifetime of an object or function, distinct objects may share a hash
+    virtual bool GetObjectIdentityHash(NativeValue* object, uint32_t* hash);
     virtual NativeValue* CreateBuffer(void** value, size_t length) = 0;
     virtual NativeValue* CreateBufferCopy(void** value, size_t length, const void* data) = 0;
     virtual NativeValue* CreateBufferExternal(void* value, size_t length, NativeFinalize cb, void* hint) = 0;
@@ -213,6 +252,22 @@ public:
     virtual bool StartHeapTracking(double timeInterval, bool isVmMode = true) = 0;
     virtual bool StopHeapTracking(const std::string &filePath) = 0;
 
+    // jobBudget limits the jobs drained per loop tick in MICROTASK_BATCHED mode, 0 means no limit, see RunMicrotasks
+    void SetMicrotaskPolicy(MicrotaskPolicy policy, uint32_t jobBudget = 0);
+    MicrotaskPolicy GetMicrotaskPolicy() const
+    {
+        return microtaskPolicy_;
+    }
+    uint32_t GetMicrotaskJobBudget() const
+    {
+        return microtaskJobBudget_;
+    }
+    // Checkpoint after a JS call returns, honoring the microtask policy
+    void MicrotaskCheckpoint();
+    // Drain pending jobs, at most budget of them when budget is not 0.
+    // Without a budget QuickJS drains through js_std_loop, which also fires its due timers.
+    virtual void RunMicrotasks(uint32_t budget = 0) {}
+
     NativeErrorExtendedInfo* GetLastError();
     void SetLastError(int errorCode, uint32_t engineErrorCode = 0, void* engineReserved = nullptr);
     void ClearLastError();
@@ -314,6 +369,11 @@ protected:
 
 private:
     bool isMainThread_ { true };
+    MicrotaskPolicy microtaskPolicy_ { MICROTASK_IMMEDIATE };
+    uint32_t microtaskJobBudget_ { 0 };
+    uint32_t identityHashSeed_ { 0 };
+    // Weak references to objects numbered without an identity hash property
+    std::vector<std::pair<NativeReference*, uint32_t>> identityHashTable_;
 
 #if !defined(WINDOWS_PLATFORM) && !defined(MAC_PLATFORM) && !defined(IOS_PLATFORM)
     static void UVThreadRunner(void* nativeEngine);
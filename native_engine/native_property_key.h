@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_PROPERTY_KEY_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_PROPERTY_KEY_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * A property name resolved once and reused for repeated lookups.
+ * Engines that can intern names subclass it and keep the interned form alive until the key is deleted.
+ */
+class NativePropertyKey {
+public:
+    NativePropertyKey(const char* name, size_t length) : name_(name, length) {}
+    virtual ~NativePropertyKey() = default;
+
+    const char* GetName() const
+    {
+        return name_.c_str();
+    }
+
+private:
+    std::string name_;
+};
+
+/*
+ * A fixed list of property keys for creating objects with the same layout over and over.
+ */
+class NativeObjectTemplate {
+public:
+    explicit NativeObjectTemplate(std::vector<std::unique_ptr<NativePropertyKey>>&& keys) : keys_(std::move(keys)) {}
+    ~NativeObjectTemplate() = default;
+
+    size_t GetPropertyCount() const
+    {
+        return keys_.size();
+    }
+
+    NativePropertyKey* GetPropertyKey(size_t index) const
+    {
+        return keys_[index].get();
+    }
+
+private:
+    std::vector<std::unique_ptr<NativePropertyKey>> keys_;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_PROPERTY_KEY_H */
@@ -20,14 +20,18 @@
 #include <cstdint>
 
 #include "../../../third_party/node/src/js_native_api.h"
+#include "native_engine/native_property_key.h"
 
 class NativeValue;
 class NativeEngine;
 
 struct NativePropertyDescriptor;
 struct NativeCallbackInfo;
+struct NativeScope;
 
 typedef NativeValue* (*NativeCallback)(NativeEngine* engine, NativeCallbackInfo*);
+// Wraps this, new.target or the argument at index of an ongoing call, see NativeCallbackInfo
+typedef NativeValue* (*NativeCallbackWrapper)(NativeCallbackInfo* info, size_t index);
 typedef void (*NativeFinalize)(NativeEngine* engine, void* data, void* hint);
 
 typedef void (*NativeAsyncExecuteCallback)(NativeEngine* engine, void* data);
@@ -51,11 +55,29 @@ struct NativeFunctionInfo {
 };
 
 struct NativeCallbackInfo {
+    static constexpr size_t THIS_INDEX = SIZE_MAX;
+    static constexpr size_t NEW_TARGET_INDEX = SIZE_MAX - 1;
+
     size_t argc = 0;
     NativeValue** argv = nullptr;
     NativeValue* thisVar = nullptr;
     NativeValue* function = nullptr;
     NativeFunctionInfo* functionInfo = nullptr;
+
+    // Engines that wrap on demand leave argv entries, thisVar and function null and set wrapper.
+    // rawInfo is the engine's own call frame, scope is the one opened for the call and owns the wrappers.
+    NativeCallbackWrapper wrapper = nullptr;
+    void* rawInfo = nullptr;
+    NativeScope* scope = nullptr;
+    // A plain call has no new.target and wraps to null, this keeps it from being asked again
+    bool newTargetWrapped = false;
+
+    NativeValue* GetArgument(size_t index);
+    NativeValue* GetThis();
+    NativeValue* GetNewTarget();
+
+private:
+    NativeValue* Wrap(size_t index);
 };
 
 typedef void (*NaitveFinalize)(NativeEngine* env, void* data, void* hint);
@@ -199,6 +221,11 @@ public:
     virtual size_t GetLength() = 0;
     virtual size_t EncodeWriteUtf8(char* buffer, size_t bufferSize, int32_t* nchars) = 0;
     virtual void GetCString16(char16_t* buffer, size_t size, size_t* length) = 0;
+    // Borrow the UTF-8 contents, valid while this value is alive; false if the engine must copy
+    virtual bool GetCStringView(const char** buffer, size_t* length)
+    {
+        return false;
+    }
 };
 
 class NativeObject {
@@ -226,6 +253,15 @@ public:
     virtual bool HasProperty(const char* name) = 0;
     virtual bool DeleteProperty(const char* name) = 0;
 
+    virtual bool SetProperty(NativePropertyKey* key, NativeValue* value)
+    {
+        return SetProperty(key->GetName(), value);
+    }
+    virtual NativeValue* GetProperty(NativePropertyKey* key)
+    {
+        return GetProperty(key->GetName());
+    }
+
     virtual bool SetPrivateProperty(const char* name, NativeValue* value) = 0;
     virtual NativeValue* GetPrivateProperty(const char* name) = 0;
     virtual bool HasPrivateProperty(const char* name) = 0;
@@ -18,6 +18,8 @@
 
 #include "securec.h"
 
+#include "listener_registry.h"
+
 #include <map>
 #include <string>
 
@@ -32,79 +34,34 @@ static std::map<std::string, std::string> g_keyValueStorage;
 /***********************************************
  * Storage Constructor
  ***********************************************/
-struct EventHandler {
-    napi_ref callbackRef = nullptr;
-    EventHandler* next = nullptr;
-};
-
 class EventListener {
 public:
-    EventListener() : type_(nullptr), handlers_(nullptr) {}
+    EventListener() : type_(nullptr) {}
     virtual ~EventListener() {}
     void Add(napi_env env, napi_value handler)
     {
-        if (Find(env, handler) != nullptr)
-            return;
-
-        if (handlers_ == nullptr) {
-            handlers_ = new EventHandler();
-            handlers_->next = nullptr;
-        } else {
-            auto temp = new EventHandler();
-            temp->next = handlers_;
-            handlers_ = temp;
-        }
-        napi_create_reference(env, handler, 1, &handlers_->callbackRef);
+        handlers_.Add(env, handler);
     }
 
     void Del(napi_env env, napi_value handler)
     {
-        EventHandler* temp = nullptr;
-        for (EventHandler* i = handlers_; i != nullptr; i = handlers_) {
-            napi_value callback = nullptr;
-            napi_get_reference_value(env, i->callbackRef, &callback);
-            bool isEquals = false;
-            napi_strict_equals(env, handler, callback, &isEquals);
-            if (isEquals) {
-                if (temp == nullptr) {
-                    handlers_ = i->next;
-                } else {
-                    temp->next = i->next;
-                }
-                napi_delete_reference(env, i->callbackRef);
-                delete i;
-            } else {
-                temp = i;
-            }
-        }
+        handlers_.Remove(env, handler);
     }
 
     void Clear(napi_env env)
     {
-        for (EventHandler* i = handlers_; i != nullptr; i = handlers_) {
-            handlers_ = i->next;
-            delete i;
-        }
+        handlers_.Clear(env);
     }
 
-    const char* type_;
-    EventHandler* handlers_;
-
-protected:
-    EventHandler* Find(napi_env env, napi_value handler)
+    void Emit(napi_env env, napi_value thisArg)
     {
-        EventHandler* result = nullptr;
-        for (EventHandler* i = handlers_; i != nullptr; i = i->next) {
-            napi_value callback = nullptr;
-            napi_get_reference_value(env, i->callbackRef, &callback);
-            bool isEquals = false;
-            napi_strict_equals(env, handler, callback, &isEquals);
-            if (isEquals) {
-                result = i;
-            }
-        }
-        return result;
+        handlers_.Emit(env, thisArg, 0, nullptr);
     }
+
+    const char* type_;
+
+private:
+    ListenerRegistry handlers_;
 };
 
 enum StorageEvent {
@@ -158,15 +115,7 @@ public:
         if (event == STORAGE_EVENT_UNKNOWN) {
             return;
         }
-        for (EventHandler* handler = listeners_[event].handlers_; handler != nullptr; handler = handler->next) {
-            if (thisArg == nullptr) {
-                napi_get_undefined(env_, &thisArg);
-            }
-            napi_value callback = nullptr;
-            napi_value result = nullptr;
-            napi_get_reference_value(env_, handler->callbackRef, &callback);
-            napi_call_function(env_, thisArg, callback, 0, nullptr, &result);
-        }
+        listeners_[event].Emit(env_, thisArg);
     }
 
 protected:
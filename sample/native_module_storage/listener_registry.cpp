@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "listener_registry.h"
+
+#include <vector>
+
+bool ListenerRegistry::Add(napi_env env, napi_value handler)
+{
+    uint32_t hash = 0;
+    if (napi_get_object_identity_hash(env, handler, &hash) != napi_ok) {
+        return false;
+    }
+    if (Find(env, handler, hash) != index_.end()) {
+        return false;
+    }
+    napi_ref handlerRef = nullptr;
+    if (napi_create_reference(env, handler, 1, &handlerRef) != napi_ok) {
+        return false;
+    }
+    auto position = handlers_.insert(handlers_.end(), handlerRef);
+    index_.emplace(hash, position);
+    return true;
+}
+
+bool ListenerRegistry::Remove(napi_env env, napi_value handler)
+{
+    uint32_t hash = 0;
+    if (napi_get_object_identity_hash(env, handler, &hash) != napi_ok) {
+        return false;
+    }
+    auto entry = Find(env, handler, hash);
+    if (entry == index_.end()) {
+        return false;
+    }
+    napi_delete_reference(env, *entry->second);
+    handlers_.erase(entry->second);
+    index_.erase(entry);
+    return true;
+}
+
+void ListenerRegistry::Clear(napi_env env)
+{
+    for (napi_ref handlerRef : handlers_) {
+        napi_delete_reference(env, handlerRef);
+    }
+    handlers_.clear();
+    index_.clear();
+}
+
+void ListenerRegistry::Emit(napi_env env, napi_value thisArg, size_t argc, const napi_value* argv)
+{
+    // Handlers may add or remove handlers while running, call the ones registered when the event fired
+    std::vector<napi_value> callbacks;
+    callbacks.reserve(handlers_.size());
+    for (napi_ref handlerRef : handlers_) {
+        napi_value callback = nullptr;
+        napi_get_reference_value(env, handlerRef, &callback);
+        callbacks.push_back(callback);
+    }
+    if (thisArg == nullptr) {
+        napi_get_undefined(env, &thisArg);
+    }
+    for (napi_value callback : callbacks) {
+        napi_value result = nullptr;
+        napi_call_function(env, thisArg, callback, argc, argv, &result);
+    }
+}
+
+ListenerRegistry::HandlerIndex::iterator ListenerRegistry::Find(napi_env env, napi_value handler, uint32_t hash)
+{
+    auto range = index_.equal_range(hash);
+    for (auto entry = range.first; entry != range.second; ++entry) {
+        napi_value callback = nullptr;
+        napi_get_reference_value(env, *entry->second, &callback);
+        bool isEquals = false;
+        napi_strict_equals(env, handler, callback, &isEquals);
+        if (isEquals) {
+            return entry;
+        }
+    }
+    return index_.end();
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_SAMPLE_NATIVE_MODULE_STORAGE_LISTENER_REGISTRY_H
+#define FOUNDATION_ACE_NAPI_SAMPLE_NATIVE_MODULE_STORAGE_LISTENER_REGISTRY_H
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+#include "napi/native_api.h"
+
+/*
+ * Set of JS handlers keyed by object identity.
+ * Handlers are bucketed by napi_get_object_identity_hash, only handlers sharing a hash are compared with
+ * napi_strict_equals, so Add and Remove do not depend on the number of registered handlers.
+ * Emit calls the handlers in registration order. Clear must run before the registry is destroyed.
+ */
+class ListenerRegistry {
+public:
+    ListenerRegistry() = default;
+    ~ListenerRegistry() = default;
+
+    ListenerRegistry(const ListenerRegistry&) = delete;
+    ListenerRegistry& operator=(const ListenerRegistry&) = delete;
+
+    // false if the handler is already registered
+    bool Add(napi_env env, napi_value handler);
+    // false if the handler is not registered
+    bool Remove(napi_env env, napi_value handler);
+    void Clear(napi_env env);
+    void Emit(napi_env env, napi_value thisArg, size_t argc, const napi_value* argv);
+
+private:
+    using HandlerList = std::list<napi_ref>;
+    using HandlerIndex = std::unordered_multimap<uint32_t, HandlerList::iterator>;
+
+    HandlerIndex::iterator Find(napi_env env, napi_value handler, uint32_t hash);
+
+    HandlerList handlers_;
+    HandlerIndex index_;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_SAMPLE_NATIVE_MODULE_STORAGE_LISTENER_REGISTRY_H */
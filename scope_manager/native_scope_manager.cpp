@@ -23,9 +23,15 @@ struct NativeHandle {
     NativeHandle* sibling = nullptr;
 };
 
+struct NativeScopeBuffer {
+    char* data = nullptr;
+    NativeScopeBuffer* sibling = nullptr;
+};
+
 struct NativeScope {
     static NativeScope* CreateNewInstance() { return new NativeScope(); }
     NativeHandle* handlePtr = nullptr;
+    NativeScopeBuffer* bufferPtr = nullptr;
     size_t handleCount = 0;
     bool escaped = false;
 
@@ -33,6 +39,18 @@ struct NativeScope {
     NativeScope* parent = nullptr;
 };
 
+static void FreeScopeBuffers(NativeScope* scope)
+{
+    NativeScopeBuffer* buffer = scope->bufferPtr;
+    while (buffer != nullptr) {
+        NativeScopeBuffer* tempBuffer = buffer->sibling;
+        delete[] buffer->data;
+        delete buffer;
+        buffer = tempBuffer;
+    }
+    scope->bufferPtr = nullptr;
+}
+
 NativeScopeManager::NativeScopeManager()
 {
     root_ = NativeScope::CreateNewInstance();
@@ -51,6 +69,7 @@ NativeScopeManager::~NativeScopeManager()
             delete handle;
             handle = tempHandle;
         }
+        FreeScopeBuffers(scope);
         delete scope;
         scope = tempScope;
     }
@@ -93,6 +112,7 @@ void NativeScopeManager::Close(NativeScope* scope)
         delete handle;
         handle = scope->handlePtr;
     }
+    FreeScopeBuffers(scope);
     delete scope;
 }
 
@@ -170,3 +190,29 @@ void NativeScopeManager::CreateHandle(NativeValue* value)
     }
     current_->handleCount++;
 }
+
+NativeScope* NativeScopeManager::SwitchScope(NativeScope* scope)
+{
+    NativeScope* previous = current_;
+    if (scope != nullptr) {
+        current_ = scope;
+    }
+    return previous;
+}
+
+void* NativeScopeManager::Allocate(size_t size)
+{
+    if (current_ == nullptr) {
+        HILOG_ERROR("current scope is null when allocate buffer");
+        return nullptr;
+    }
+    auto buffer = new NativeScopeBuffer();
+    if (buffer == nullptr) {
+        HILOG_ERROR("create scope buffer failed");
+        return nullptr;
+    }
+    buffer->data = new char[size];
+    buffer->sibling = current_->bufferPtr;
+    current_->bufferPtr = buffer;
+    return buffer->data;
+}
@@ -33,8 +33,13 @@ public:
     virtual void CloseEscape(NativeScope* scope);
 
     virtual void CreateHandle(NativeValue* value);
+    // Makes scope receive new handles until switched back, returns the scope that received them before
+    virtual NativeScope* SwitchScope(NativeScope* scope);
     virtual NativeValue* Escape(NativeScope* scope, NativeValue* value);
 
+    // Allocate memory owned by the current scope and released when it closes
+    virtual void* Allocate(size_t size);
+
     NativeScopeManager(NativeScopeManager&) = delete;
     virtual NativeScopeManager& operator=(NativeScopeManager&) = delete;
 
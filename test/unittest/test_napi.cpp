@@ -1014,3 +1014,187 @@ HWTEST_F(NapiBasicTest, EncodeToUtf8Test001, testing::ext::TestSize.Level1)
     ASSERT_EQ(nchars, 0);
     delete[] buffer;
 }
+
+/**
+ * @tc.name: ObjectIdentityHashTest
+ * @tc.desc: Test the identity hash kept by engines without their own, for inheriting and frozen objects.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ObjectIdentityHashTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    auto constructor = [](napi_env env, napi_callback_info info) -> napi_value {
+        napi_value thisVar = nullptr;
+        napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+        return thisVar;
+    };
+    napi_value cls = nullptr;
+    ASSERT_CHECK_CALL(napi_define_class(env, "Hashed", NAPI_AUTO_LENGTH, constructor, nullptr, 0, nullptr, &cls));
+    napi_value prototype = nullptr;
+    ASSERT_CHECK_CALL(napi_get_named_property(env, cls, "prototype", &prototype));
+    napi_value first = nullptr;
+    ASSERT_CHECK_CALL(napi_new_instance(env, cls, 0, nullptr, &first));
+    napi_value second = nullptr;
+    ASSERT_CHECK_CALL(napi_new_instance(env, cls, 0, nullptr, &second));
+
+    // Call the fallback directly, engines with their own hash override it
+    uint32_t prototypeHash = 0;
+    ASSERT_TRUE(engine_->NativeEngine::GetObjectIdentityHash(reinterpret_cast<NativeValue*>(prototype),
+        &prototypeHash));
+    uint32_t firstHash = 0;
+    ASSERT_TRUE(engine_->NativeEngine::GetObjectIdentityHash(reinterpret_cast<NativeValue*>(first), &firstHash));
+    uint32_t secondHash = 0;
+    ASSERT_TRUE(engine_->NativeEngine::GetObjectIdentityHash(reinterpret_cast<NativeValue*>(second), &secondHash));
+    ASSERT_NE(firstHash, prototypeHash);
+    ASSERT_NE(secondHash, prototypeHash);
+    ASSERT_NE(firstHash, secondHash);
+    uint32_t hash = 0;
+    ASSERT_TRUE(engine_->NativeEngine::GetObjectIdentityHash(reinterpret_cast<NativeValue*>(first), &hash));
+    ASSERT_EQ(hash, firstHash);
+
+    napi_value frozen = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &frozen));
+    ASSERT_CHECK_CALL(napi_object_freeze(env, frozen));
+    uint32_t frozenHash = 0;
+    ASSERT_TRUE(engine_->NativeEngine::GetObjectIdentityHash(reinterpret_cast<NativeValue*>(frozen), &frozenHash));
+    ASSERT_TRUE(engine_->NativeEngine::GetObjectIdentityHash(reinterpret_cast<NativeValue*>(frozen), &hash));
+    ASSERT_EQ(hash, frozenHash);
+    ASSERT_NE(frozenHash, firstHash);
+
+    // The property is not enumerable, on engines whose data properties honour the requested attributes
+    napi_value probe = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &probe));
+    napi_property_descriptor probeDescriptor[] = {
+        { "probe", nullptr, nullptr, nullptr, nullptr, prototype, napi_default, nullptr },
+    };
+    ASSERT_CHECK_CALL(napi_define_properties(env, probe, 1, probeDescriptor));
+    napi_value names = nullptr;
+    ASSERT_CHECK_CALL(napi_get_property_names(env, probe, &names));
+    uint32_t nameCount = 0;
+    ASSERT_CHECK_CALL(napi_get_array_length(env, names, &nameCount));
+    if (nameCount == 0) {
+        ASSERT_CHECK_CALL(napi_get_property_names(env, first, &names));
+        ASSERT_CHECK_CALL(napi_get_array_length(env, names, &nameCount));
+        ASSERT_EQ(nameCount, 0);
+    }
+
+    ASSERT_CHECK_CALL(napi_get_object_identity_hash(env, first, &hash));
+    ASSERT_CHECK_CALL(napi_get_object_identity_hash(env, frozen, &hash));
+}
+
+/**
+ * @tc.name: CallbackArgumentTest
+ * @tc.desc: Test that callback arguments stay valid when returned or referenced from the callback, and that values
+ *           read from them can be escaped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, CallbackArgumentTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+
+    static napi_ref argumentRef = nullptr;
+    static bool escapeKept = false;
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        size_t argc = 3;
+        napi_value argv[3] = { nullptr };
+        NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr));
+        NAPI_CALL(env, napi_create_reference(env, argv[1], 1, &argumentRef));
+
+        // a value read from an argument inside the escapable scope survives its close
+        napi_escapable_handle_scope scope = nullptr;
+        NAPI_CALL(env, napi_open_escapable_handle_scope(env, &scope));
+        napi_value property = nullptr;
+        NAPI_CALL(env, napi_get_named_property(env, argv[2], "second", &property));
+        napi_value escaped = nullptr;
+        NAPI_CALL(env, napi_escape_handle(env, scope, property, &escaped));
+        NAPI_CALL(env, napi_close_escapable_handle_scope(env, scope));
+        NAPI_CALL(env, napi_strict_equals(env, escaped, argv[0], &escapeKept));
+        return argv[0];
+    };
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, "func", NAPI_AUTO_LENGTH, func, nullptr, &function));
+
+    napi_value argv[3] = { nullptr };
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, "first", NAPI_AUTO_LENGTH, &argv[0]));
+    ASSERT_CHECK_CALL(napi_create_object(env, &argv[1]));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, argv[1], "first", argv[0]));
+    ASSERT_CHECK_CALL(napi_create_object(env, &argv[2]));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, argv[2], "second", argv[0]));
+    napi_value recv = nullptr;
+    ASSERT_CHECK_CALL(napi_get_undefined(env, &recv));
+
+    napi_value result = nullptr;
+    ASSERT_CHECK_CALL(napi_call_function(env, recv, function, 3, argv, &result));
+    ASSERT_CHECK_VALUE_TYPE(env, result, napi_string);
+    char buffer[64] = { 0 };
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_get_value_string_utf8(env, result, buffer, sizeof(buffer), &length));
+    ASSERT_STREQ(buffer, "first");
+
+    ASSERT_NE(argumentRef, nullptr);
+    napi_value stored = nullptr;
+    ASSERT_CHECK_CALL(napi_get_reference_value(env, argumentRef, &stored));
+    bool isEqual = false;
+    ASSERT_CHECK_CALL(napi_strict_equals(env, stored, argv[1], &isEqual));
+    ASSERT_TRUE(isEqual);
+    ASSERT_CHECK_CALL(napi_delete_reference(env, argumentRef));
+    argumentRef = nullptr;
+    ASSERT_TRUE(escapeKept);
+}
+
+/**
+ * @tc.name: CallbackInfoTest
+ * @tc.desc: Test that repeated napi_get_cb_info calls return the same handles, also for arguments first read
+ *           inside a handle scope the callback has closed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, CallbackInfoTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+
+    static bool handlesStable = false;
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        napi_handle_scope scope = nullptr;
+        NAPI_CALL(env, napi_open_handle_scope(env, &scope));
+        size_t argc = 2;
+        napi_value argv[2] = { nullptr };
+        napi_value thisVar = nullptr;
+        NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr));
+        napi_value newTarget = nullptr;
+        NAPI_CALL(env, napi_get_new_target(env, info, &newTarget));
+        NAPI_CALL(env, napi_close_handle_scope(env, scope));
+
+        size_t againArgc = 2;
+        napi_value again[2] = { nullptr };
+        napi_value againThis = nullptr;
+        NAPI_CALL(env, napi_get_cb_info(env, info, &againArgc, again, &againThis, nullptr));
+        napi_value againNewTarget = nullptr;
+        NAPI_CALL(env, napi_get_new_target(env, info, &againNewTarget));
+        handlesStable = argv[0] == again[0] && argv[1] == again[1] && thisVar == againThis &&
+            newTarget == againNewTarget;
+
+        // the wrappers belong to the call, not to the scope they were first read in
+        napi_value value = nullptr;
+        NAPI_CALL(env, napi_get_named_property(env, argv[1], "value", &value));
+        return value;
+    };
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, "func", NAPI_AUTO_LENGTH, func, nullptr, &function));
+
+    napi_value argv[2] = { nullptr };
+    ASSERT_CHECK_CALL(napi_create_int32(env, 1, &argv[0]));
+    ASSERT_CHECK_CALL(napi_create_object(env, &argv[1]));
+    napi_value value = nullptr;
+    ASSERT_CHECK_CALL(napi_create_int32(env, 2, &value));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, argv[1], "value", value));
+    napi_value recv = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &recv));
+
+    napi_value result = nullptr;
+    ASSERT_CHECK_CALL(napi_call_function(env, recv, function, 2, argv, &result));
+    ASSERT_TRUE(handlesStable);
+    ASSERT_CHECK_VALUE_TYPE(env, result, napi_number);
+    int32_t number = 0;
+    ASSERT_CHECK_CALL(napi_get_value_int32(env, result, &number));
+    ASSERT_EQ(number, 2);
+}
@@ -0,0 +1,754 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "napi/native_api.h"
+#include "napi/native_node_api.h"
+#include "securec.h"
+#include "test.h"
+#include "test_common.h"
+#include "utils/log.h"
+#include "utils/unicode.h"
+
+#ifdef FOR_QUICKJS_TEST
+#include "quickjs_buffer_pool.h"
+#include "quickjs_native_engine.h"
+#endif
+
+namespace {
+constexpr size_t BENCHMARK_SIZES[] = { 64, 4 * 1024, 64 * 1024, 1024 * 1024 };
+constexpr int BENCHMARK_ROUNDS = 10;
+constexpr uint32_t BENCHMARK_ARRAY_LENGTH = 100000;
+constexpr uint32_t BENCHMARK_OBJECT_COUNT = 10000;
+constexpr uint32_t BENCHMARK_CALL_COUNT = 100000;
+
+template<typename Func>
+int64_t MeasureNanoseconds(Func&& func)
+{
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+// Resident set size from /proc/self/statm, 0 if unavailable
+size_t ReadResidentBytes()
+{
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (file == nullptr) {
+        return 0;
+    }
+    unsigned long totalPages = 0;
+    unsigned long residentPages = 0;
+    int count = fscanf_s(file, "%lu %lu", &totalPages, &residentPages);
+    fclose(file);
+    constexpr int expectedCount = 2;
+    return (count == expectedCount) ? residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE)) : 0;
+}
+
+// Repeat the UTF-8 encoded pattern until the string reaches size bytes
+std::string MakeString(const std::string& pattern, size_t size)
+{
+    std::string result;
+    result.reserve(size + pattern.size());
+    while (result.size() < size) {
+        result += pattern;
+    }
+    return result;
+}
+
+struct StringSample {
+    const char* name;
+    std::string pattern;
+};
+
+const StringSample STRING_SAMPLES[] = {
+    { "ascii", "The quick brown fox jumps over the lazy dog. " },
+    { "latin1", "Stra\xc3\x9f" "e, Gar\xc3\xa7on, na\xc3\xaf" "ve caf\xc3\xa9. " },
+    { "cjk", "\xe4\xb8\xad\xe6\x96\x87\xe6\xb5\x8b\xe8\xaf\x95\xe5\xad\x97\xe7\xac\xa6\xe4\xb8\xb2" },
+};
+} // namespace
+
+class NapiBenchmarkTest : public NativeEngineTest {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "NapiBenchmarkTest SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "NapiBenchmarkTest TearDownTestCase";
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: EncodeToUtf8Benchmark
+ * @tc.desc: Measure EncodeToUtf8 on ASCII, Latin-1 and CJK strings of increasing size.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, EncodeToUtf8Benchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    for (const auto& sample : STRING_SAMPLES) {
+        for (size_t size : BENCHMARK_SIZES) {
+            napi_handle_scope scope = nullptr;
+            ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+            std::string str = MakeString(sample.pattern, size);
+            // A wrapper caches what it encoded, every round gets a wrapper of its own
+            NativeValue* values[BENCHMARK_ROUNDS] = { nullptr };
+            for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                values[i] = engine_->CreateString(str.c_str(), str.length());
+            }
+            std::vector<char> buffer(str.length() + 1);
+            int32_t written = 0;
+            int32_t nchars = 0;
+            int64_t cost = MeasureNanoseconds([&]() {
+                for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                    engine_->EncodeToUtf8(values[i], buffer.data(), &written, str.length(), &nchars);
+                }
+            });
+            ASSERT_EQ(static_cast<size_t>(written), str.length());
+            GTEST_LOG_(INFO) << "EncodeToUtf8 " << sample.name << " " << str.length() << " bytes: "
+                             << cost / BENCHMARK_ROUNDS << " ns";
+
+            ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+        }
+    }
+}
+
+/**
+ * @tc.name: TranscodeBenchmark
+ * @tc.desc: Measure the shared transcoding throughput on ASCII, Latin-1 and CJK strings of increasing size.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, TranscodeBenchmark001, testing::ext::TestSize.Level1)
+{
+    for (const auto& sample : STRING_SAMPLES) {
+        for (size_t size : BENCHMARK_SIZES) {
+            std::string str = MakeString(sample.pattern, size);
+            std::u16string str16(Unicode::Utf8ToUtf16Length(str.c_str(), str.length()), u'\0');
+            std::string utf8(str.length(), '\0');
+            size_t written16 = 0;
+            size_t written8 = 0;
+            bool valid = false;
+
+            int64_t validateCost = MeasureNanoseconds([&]() {
+                for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                    valid = Unicode::IsValidUtf8(str.c_str(), str.length());
+                }
+            });
+            int64_t toUtf16Cost = MeasureNanoseconds([&]() {
+                for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                    written16 = Unicode::Utf8ToUtf16(str.c_str(), str.length(), &str16[0], str16.length());
+                }
+            });
+            int64_t toUtf8Cost = MeasureNanoseconds([&]() {
+                for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                    written8 = Unicode::Utf16ToUtf8(str16.c_str(), str16.length(), &utf8[0], utf8.length());
+                }
+            });
+            ASSERT_TRUE(valid);
+            ASSERT_EQ(written16, str16.length());
+            ASSERT_EQ(written8, str.length());
+            ASSERT_EQ(utf8, str);
+
+            GTEST_LOG_(INFO) << "Transcode " << sample.name << " " << str.length() << " bytes: validate "
+                             << validateCost / BENCHMARK_ROUNDS << " ns, utf8->utf16 "
+                             << toUtf16Cost / BENCHMARK_ROUNDS << " ns, utf16->utf8 "
+                             << toUtf8Cost / BENCHMARK_ROUNDS << " ns";
+        }
+    }
+}
+
+/**
+ * @tc.name: StringUtf16Benchmark
+ * @tc.desc: Measure napi_create_string_utf16 and napi_get_value_string_utf16.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, StringUtf16Benchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    for (const auto& sample : STRING_SAMPLES) {
+        for (size_t size : BENCHMARK_SIZES) {
+            napi_handle_scope scope = nullptr;
+            ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+            std::string str = MakeString(sample.pattern, size);
+            std::u16string str16(Unicode::Utf8ToUtf16Length(str.c_str(), str.length()), u'\0');
+            Unicode::Utf8ToUtf16(str.c_str(), str.length(), &str16[0], str16.length());
+            std::vector<char16_t> buffer(str16.length() + 1);
+            napi_value value = nullptr;
+            size_t length = 0;
+
+            int64_t createCost = MeasureNanoseconds([&]() {
+                for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                    napi_create_string_utf16(env, str16.c_str(), str16.length(), &value);
+                }
+            });
+            int64_t getCost = MeasureNanoseconds([&]() {
+                for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                    napi_get_value_string_utf16(env, value, buffer.data(), buffer.size(), &length);
+                }
+            });
+            ASSERT_EQ(length, str16.length());
+            GTEST_LOG_(INFO) << "StringUtf16 " << sample.name << " " << str16.length() << " units: create "
+                             << createCost / BENCHMARK_ROUNDS << " ns, get " << getCost / BENCHMARK_ROUNDS << " ns";
+
+            ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+        }
+    }
+}
+
+/**
+ * @tc.name: StringLatin1Benchmark
+ * @tc.desc: Compare napi_create_string_latin1 against napi_create_string_utf8 on ASCII-heavy payloads.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, StringLatin1Benchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    for (size_t size : BENCHMARK_SIZES) {
+        napi_handle_scope scope = nullptr;
+        ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+        std::string str = MakeString("{\"key\":\"value\",\"id\":12345,\"name\":\"caf\xe9\"}", size);
+        napi_value value = nullptr;
+        int64_t latin1Cost = MeasureNanoseconds([&]() {
+            for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                napi_create_string_latin1(env, str.c_str(), str.length(), &value);
+            }
+        });
+        int64_t utf8Cost = MeasureNanoseconds([&]() {
+            for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                napi_create_string_utf8(env, str.c_str(), str.length(), &value);
+            }
+        });
+        GTEST_LOG_(INFO) << "CreateString " << str.length() << " bytes: latin1 " << latin1Cost / BENCHMARK_ROUNDS
+                         << " ns, utf8 " << utf8Cost / BENCHMARK_ROUNDS << " ns";
+
+        ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+    }
+}
+
+/**
+ * @tc.name: ElementsBenchmark
+ * @tc.desc: Compare bulk array element reads against one napi_get_element call per element.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, ElementsBenchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    std::vector<double> values(BENCHMARK_ARRAY_LENGTH);
+    for (uint32_t i = 0; i < BENCHMARK_ARRAY_LENGTH; i++) {
+        values[i] = i * 0.5;
+    }
+    napi_value array = nullptr;
+    ASSERT_CHECK_CALL(napi_create_array_with_length(env, BENCHMARK_ARRAY_LENGTH, &array));
+    ASSERT_CHECK_CALL(napi_set_elements_double(env, array, 0, BENCHMARK_ARRAY_LENGTH, values.data()));
+
+    std::vector<double> result(BENCHMARK_ARRAY_LENGTH);
+    int64_t elementCost = MeasureNanoseconds([&]() {
+        napi_handle_scope loopScope = nullptr;
+        napi_open_handle_scope(env, &loopScope);
+        for (uint32_t i = 0; i < BENCHMARK_ARRAY_LENGTH; i++) {
+            napi_value element = nullptr;
+            napi_get_element(env, array, i, &element);
+            napi_get_value_double(env, element, &result[i]);
+        }
+        napi_close_handle_scope(env, loopScope);
+    });
+    int64_t bulkCost = MeasureNanoseconds([&]() {
+        napi_get_elements_double(env, array, 0, BENCHMARK_ARRAY_LENGTH, result.data());
+    });
+    ASSERT_EQ(result, values);
+    GTEST_LOG_(INFO) << "GetElements " << BENCHMARK_ARRAY_LENGTH << " doubles: per element " << elementCost
+                     << " ns, bulk " << bulkCost << " ns";
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+
+/**
+ * @tc.name: ObjectTemplateBenchmark
+ * @tc.desc: Compare object creation from a template against napi_create_object plus per-property sets.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, ObjectTemplateBenchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    const char* names[] = { "id", "name", "size", "modified" };
+    constexpr size_t fieldCount = sizeof(names) / sizeof(names[0]);
+    napi_value values[fieldCount] = { nullptr };
+    ASSERT_CHECK_CALL(napi_create_int32(env, 1, &values[0]));
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, "file.txt", NAPI_AUTO_LENGTH, &values[1]));
+    ASSERT_CHECK_CALL(napi_create_double(env, 4096, &values[2]));
+    ASSERT_CHECK_CALL(napi_get_boolean(env, true, &values[3]));
+
+    int64_t propertyCost = MeasureNanoseconds([&]() {
+        for (uint32_t i = 0; i < BENCHMARK_OBJECT_COUNT; i++) {
+            napi_handle_scope loopScope = nullptr;
+            napi_open_handle_scope(env, &loopScope);
+            napi_value object = nullptr;
+            napi_create_object(env, &object);
+            for (size_t j = 0; j < fieldCount; j++) {
+                napi_set_named_property(env, object, names[j], values[j]);
+            }
+            napi_close_handle_scope(env, loopScope);
+        }
+    });
+
+    int64_t bulkCost = MeasureNanoseconds([&]() {
+        for (uint32_t i = 0; i < BENCHMARK_OBJECT_COUNT; i++) {
+            napi_handle_scope loopScope = nullptr;
+            napi_open_handle_scope(env, &loopScope);
+            napi_value object = nullptr;
+            napi_create_object_with_properties(env, nullptr, names, values, fieldCount, &object);
+            napi_close_handle_scope(env, loopScope);
+        }
+    });
+
+    napi_object_template objectTemplate = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object_template(env, names, fieldCount, &objectTemplate));
+    int64_t templateCost = MeasureNanoseconds([&]() {
+        for (uint32_t i = 0; i < BENCHMARK_OBJECT_COUNT; i++) {
+            napi_handle_scope loopScope = nullptr;
+            napi_open_handle_scope(env, &loopScope);
+            napi_value object = nullptr;
+            napi_new_object_from_template(env, objectTemplate, values, &object);
+            napi_close_handle_scope(env, loopScope);
+        }
+    });
+    ASSERT_CHECK_CALL(napi_delete_object_template(env, objectTemplate));
+
+    GTEST_LOG_(INFO) << "CreateObject " << BENCHMARK_OBJECT_COUNT << " x " << fieldCount << " fields: per property "
+                     << propertyCost << " ns, with properties " << bulkCost << " ns, template " << templateCost
+                     << " ns";
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+
+/**
+ * @tc.name: CallFunctionBenchmark
+ * @tc.desc: Measure the per-call overhead of a native function taking 4 arguments of mixed types.
+ *           Numbers and objects are also measured on their own, since they sit at opposite ends of
+ *           the wrapper classification order.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, CallFunctionBenchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        size_t argc = 4;
+        napi_value argv[4] = { nullptr };
+        napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+        return argv[0];
+    };
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, "func", NAPI_AUTO_LENGTH, func, nullptr, &function));
+    napi_value recv = nullptr;
+    ASSERT_CHECK_CALL(napi_get_undefined(env, &recv));
+
+    auto measure = [&](const char* name, napi_value* argv) {
+        int64_t cost = MeasureNanoseconds([&]() {
+            for (uint32_t i = 0; i < BENCHMARK_CALL_COUNT; i++) {
+                napi_handle_scope loopScope = nullptr;
+                napi_open_handle_scope(env, &loopScope);
+                napi_value result = nullptr;
+                napi_call_function(env, recv, function, 4, argv, &result);
+                napi_close_handle_scope(env, loopScope);
+            }
+        });
+        GTEST_LOG_(INFO) << "CallFunction 4 " << name << " arguments: " << cost / BENCHMARK_CALL_COUNT
+                         << " ns per call";
+    };
+
+    napi_value mixed[4] = { nullptr };
+    ASSERT_CHECK_CALL(napi_create_int32(env, 1, &mixed[0]));
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, "arg", NAPI_AUTO_LENGTH, &mixed[1]));
+    ASSERT_CHECK_CALL(napi_get_boolean(env, true, &mixed[2]));
+    ASSERT_CHECK_CALL(napi_create_object(env, &mixed[3]));
+    measure("mixed", mixed);
+
+    napi_value numbers[4] = { nullptr };
+    napi_value objects[4] = { nullptr };
+    for (int32_t i = 0; i < 4; i++) {
+        ASSERT_CHECK_CALL(napi_create_int32(env, i, &numbers[i]));
+        ASSERT_CHECK_CALL(napi_create_object(env, &objects[i]));
+    }
+    measure("number", numbers);
+    measure("object", objects);
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+
+/**
+ * @tc.name: CallbackArgumentBenchmark
+ * @tc.desc: Measure a call with 10 arguments where the callback reads only the first one.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, CallbackArgumentBenchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        size_t argc = 1;
+        napi_value argv[1] = { nullptr };
+        napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+        return argv[0];
+    };
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, "func", NAPI_AUTO_LENGTH, func, nullptr, &function));
+
+    constexpr size_t argumentCount = 10;
+    napi_value argv[argumentCount] = { nullptr };
+    for (size_t i = 0; i < argumentCount; i++) {
+        ASSERT_CHECK_CALL(napi_create_uint32(env, i, &argv[i]));
+    }
+    napi_value recv = nullptr;
+    ASSERT_CHECK_CALL(napi_get_undefined(env, &recv));
+
+    int64_t cost = MeasureNanoseconds([&]() {
+        for (uint32_t i = 0; i < BENCHMARK_CALL_COUNT; i++) {
+            napi_handle_scope loopScope = nullptr;
+            napi_open_handle_scope(env, &loopScope);
+            napi_value result = nullptr;
+            napi_call_function(env, recv, function, argumentCount, argv, &result);
+            napi_close_handle_scope(env, loopScope);
+        }
+    });
+    GTEST_LOG_(INFO) << "CallFunction 10 arguments, 1 read: " << cost / BENCHMARK_CALL_COUNT << " ns per call";
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+
+/**
+ * @tc.name: CreateExternalBenchmark
+ * @tc.desc: Measure the creation rate of externals and native functions.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, CreateExternalBenchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    static int externalData = 0;
+    int64_t externalCost = MeasureNanoseconds([&]() {
+        napi_handle_scope loopScope = nullptr;
+        napi_open_handle_scope(env, &loopScope);
+        for (uint32_t i = 0; i < BENCHMARK_OBJECT_COUNT; i++) {
+            napi_value external = nullptr;
+            napi_create_external(env, &externalData, nullptr, nullptr, &external);
+        }
+        napi_close_handle_scope(env, loopScope);
+    });
+    GTEST_LOG_(INFO) << "napi_create_external: " << externalCost / BENCHMARK_OBJECT_COUNT << " ns per external";
+
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        return nullptr;
+    };
+    int64_t functionCost = MeasureNanoseconds([&]() {
+        napi_handle_scope loopScope = nullptr;
+        napi_open_handle_scope(env, &loopScope);
+        for (uint32_t i = 0; i < BENCHMARK_OBJECT_COUNT; i++) {
+            napi_value function = nullptr;
+            napi_create_function(env, "func", NAPI_AUTO_LENGTH, func, nullptr, &function);
+        }
+        napi_close_handle_scope(env, loopScope);
+    });
+    GTEST_LOG_(INFO) << "napi_create_function: " << functionCost / BENCHMARK_OBJECT_COUNT << " ns per function";
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+
+/**
+ * @tc.name: NewInstanceBenchmark
+ * @tc.desc: Measure constructing instances of a class defined with napi_define_class.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, NewInstanceBenchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    auto constructor = [](napi_env env, napi_callback_info info) -> napi_value {
+        napi_value thisVar = nullptr;
+        napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+        return thisVar;
+    };
+    napi_value cls = nullptr;
+    ASSERT_CHECK_CALL(napi_define_class(env, "Record", NAPI_AUTO_LENGTH, constructor, nullptr, 0, nullptr, &cls));
+
+    napi_value argv[1] = { nullptr };
+    ASSERT_CHECK_CALL(napi_create_int32(env, 1, &argv[0]));
+
+    int64_t cost = MeasureNanoseconds([&]() {
+        for (uint32_t i = 0; i < BENCHMARK_CALL_COUNT; i++) {
+            napi_handle_scope loopScope = nullptr;
+            napi_open_handle_scope(env, &loopScope);
+            napi_value instance = nullptr;
+            napi_new_instance(env, cls, 1, argv, &instance);
+            napi_close_handle_scope(env, loopScope);
+        }
+    });
+    GTEST_LOG_(INFO) << "napi_new_instance: " << cost / BENCHMARK_CALL_COUNT << " ns per instance";
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+
+/**
+ * @tc.name: WrappedMethodBenchmark
+ * @tc.desc: Measure calling a method that unwraps its receiver on an instance of a napi_define_class class.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, WrappedMethodBenchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    auto constructor = [](napi_env env, napi_callback_info info) -> napi_value {
+        napi_value thisVar = nullptr;
+        napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+        napi_wrap(
+            env, thisVar, new int64_t(0),
+            [](napi_env env, void* data, void* hint) { delete reinterpret_cast<int64_t*>(data); }, nullptr,
+            nullptr);
+        return thisVar;
+    };
+    auto increment = [](napi_env env, napi_callback_info info) -> napi_value {
+        napi_value thisVar = nullptr;
+        napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+        int64_t* counter = nullptr;
+        napi_unwrap(env, thisVar, reinterpret_cast<void**>(&counter));
+        if (counter != nullptr) {
+            ++*counter;
+        }
+        return nullptr;
+    };
+    napi_property_descriptor desc[] = {
+        DECLARE_NAPI_FUNCTION("increment", increment),
+    };
+    napi_value cls = nullptr;
+    ASSERT_CHECK_CALL(napi_define_class(
+        env, "Counter", NAPI_AUTO_LENGTH, constructor, nullptr, sizeof(desc) / sizeof(desc[0]), desc, &cls));
+    napi_value instance = nullptr;
+    ASSERT_CHECK_CALL(napi_new_instance(env, cls, 0, nullptr, &instance));
+    napi_value method = nullptr;
+    ASSERT_CHECK_CALL(napi_get_named_property(env, instance, "increment", &method));
+
+    int64_t cost = MeasureNanoseconds([&]() {
+        for (uint32_t i = 0; i < BENCHMARK_CALL_COUNT; i++) {
+            napi_handle_scope loopScope = nullptr;
+            napi_open_handle_scope(env, &loopScope);
+            napi_value result = nullptr;
+            napi_call_function(env, instance, method, 0, nullptr, &result);
+            napi_close_handle_scope(env, loopScope);
+        }
+    });
+    GTEST_LOG_(INFO) << "wrapped method call: " << cost / BENCHMARK_CALL_COUNT << " ns per call";
+
+    int64_t* counter = nullptr;
+    ASSERT_CHECK_CALL(napi_unwrap(env, instance, reinterpret_cast<void**>(&counter)));
+    ASSERT_NE(counter, nullptr);
+    ASSERT_EQ(*counter, static_cast<int64_t>(BENCHMARK_CALL_COUNT));
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+
+/**
+ * @tc.name: TypedArrayViewBenchmark
+ * @tc.desc: Measure creating small Uint8Array views over one ArrayBuffer.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, TypedArrayViewBenchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    constexpr size_t viewLength = 16;
+    constexpr size_t viewCount = 256;
+    void* data = nullptr;
+    napi_value arrayBuffer = nullptr;
+    ASSERT_CHECK_CALL(napi_create_arraybuffer(env, viewLength * viewCount, &data, &arrayBuffer));
+
+    int64_t cost = MeasureNanoseconds([&]() {
+        for (uint32_t i = 0; i < BENCHMARK_CALL_COUNT; i++) {
+            napi_handle_scope loopScope = nullptr;
+            napi_open_handle_scope(env, &loopScope);
+            napi_value view = nullptr;
+            napi_create_typedarray(env, napi_uint8_array, viewLength, arrayBuffer, (i % viewCount) * viewLength, &view);
+            napi_close_handle_scope(env, loopScope);
+        }
+    });
+    GTEST_LOG_(INFO) << "napi_create_typedarray view: " << cost / BENCHMARK_CALL_COUNT << " ns per view";
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+
+#ifdef FOR_QUICKJS_TEST
+/**
+ * @tc.name: BufferPoolBenchmark
+ * @tc.desc: Measure creating small Buffers with the QuickJS Buffer pool enabled and bypassed.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, BufferPoolBenchmark001, testing::ext::TestSize.Level1)
+{
+    QuickJSBufferPool* pool = static_cast<QuickJSNativeEngine*>(engine_)->GetBufferPool();
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    auto measure = [&](size_t size, bool pooled) -> int64_t {
+        pool->SetEnabled(pooled);
+        int64_t cost = MeasureNanoseconds([&]() {
+            for (uint32_t i = 0; i < BENCHMARK_CALL_COUNT; i++) {
+                napi_handle_scope loopScope = nullptr;
+                napi_open_handle_scope(env, &loopScope);
+                void* data = nullptr;
+                napi_value buffer = nullptr;
+                napi_create_buffer(env, size, &data, &buffer);
+                napi_close_handle_scope(env, loopScope);
+            }
+        });
+        pool->SetEnabled(true);
+        return cost;
+    };
+
+    constexpr size_t bufferSizes[] = { 16, 128, 512 };
+    for (size_t size : bufferSizes) {
+        int64_t pooledCost = measure(size, true);
+        int64_t unpooledCost = measure(size, false);
+        GTEST_LOG_(INFO) << size << " bytes Buffer, pooled: " << pooledCost / BENCHMARK_CALL_COUNT
+                         << " ns, unpooled: " << unpooledCost / BENCHMARK_CALL_COUNT << " ns";
+    }
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+
+/**
+ * @tc.name: BufferPoolBenchmark
+ * @tc.desc: Measure resident memory growth while many small Buffers are alive, with the Buffer pool enabled and
+ *           bypassed.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, BufferPoolBenchmark002, testing::ext::TestSize.Level1)
+{
+    QuickJSBufferPool* pool = static_cast<QuickJSNativeEngine*>(engine_)->GetBufferPool();
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    constexpr size_t bufferSize = 64;
+    auto measureResident = [&](bool pooled) -> size_t {
+        pool->SetEnabled(pooled);
+        napi_value holder = nullptr;
+        napi_create_array_with_length(env, BENCHMARK_OBJECT_COUNT, &holder);
+        size_t before = ReadResidentBytes();
+        for (uint32_t i = 0; i < BENCHMARK_OBJECT_COUNT; i++) {
+            napi_handle_scope loopScope = nullptr;
+            napi_open_handle_scope(env, &loopScope);
+            void* data = nullptr;
+            napi_value buffer = nullptr;
+            napi_create_buffer(env, bufferSize, &data, &buffer);
+            napi_set_element(env, holder, i, buffer);
+            napi_close_handle_scope(env, loopScope);
+        }
+        size_t after = ReadResidentBytes();
+        pool->SetEnabled(true);
+        return (after > before) ? after - before : 0;
+    };
+    size_t pooledBytes = measureResident(true);
+    size_t unpooledBytes = measureResident(false);
+    GTEST_LOG_(INFO) << BENCHMARK_OBJECT_COUNT << " live " << bufferSize << " byte Buffers, pooled: "
+                     << pooledBytes / 1024 << " KB, unpooled: " << unpooledBytes / 1024 << " KB resident growth";
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+#endif
+
+/**
+ * @tc.name: PostMessageBenchmark
+ * @tc.desc: Measure postMessage round trips of ArrayBuffers of increasing size, copied against transferred.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiBenchmarkTest, PostMessageBenchmark001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    napi_value undefined = nullptr;
+    napi_get_undefined(env, &undefined);
+    auto postMessage = [&](size_t size, bool transfer) {
+        napi_handle_scope loopScope = nullptr;
+        napi_open_handle_scope(env, &loopScope);
+        void* data = nullptr;
+        napi_value arrayBuffer = nullptr;
+        napi_create_arraybuffer(env, size, &data, &arrayBuffer);
+        napi_value message = nullptr;
+        napi_create_object(env, &message);
+        napi_set_named_property(env, message, "data", arrayBuffer);
+        napi_value transferList = undefined;
+        if (transfer) {
+            napi_create_array_with_length(env, 1, &transferList);
+            napi_set_element(env, transferList, 0, arrayBuffer);
+        }
+        napi_value serialized = nullptr;
+        napi_serialize(env, message, transferList, &serialized);
+        napi_value result = nullptr;
+        napi_deserialize(env, serialized, &result);
+        napi_delete_serialization_data(env, serialized);
+        napi_close_handle_scope(env, loopScope);
+    };
+    for (size_t size : BENCHMARK_SIZES) {
+        int64_t copyCost = MeasureNanoseconds([&]() {
+            for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                postMessage(size, false);
+            }
+        });
+        int64_t transferCost = MeasureNanoseconds([&]() {
+            for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+                postMessage(size, true);
+            }
+        });
+        GTEST_LOG_(INFO) << "postMessage " << size << " bytes, copied: " << copyCost / BENCHMARK_ROUNDS
+                         << " ns, transferred: " << transferCost / BENCHMARK_ROUNDS << " ns";
+    }
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
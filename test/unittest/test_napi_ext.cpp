@@ -13,6 +13,13 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "napi/native_common.h"
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
@@ -25,6 +32,28 @@
 #endif
 
 static constexpr int32_t NAPI_UT_BUFFER_SIZE = 64;
+static constexpr size_t NAPI_UT_INLINE_ARGUMENT_COUNT = 8;
+
+// Counts C++ heap allocations while g_countAllocations is set, engine heaps are not included
+static std::atomic<bool> g_countAllocations { false };
+static std::atomic<size_t> g_allocationCount { 0 };
+
+void* operator new(size_t size)
+{
+    if (g_countAllocations) {
+        g_allocationCount++;
+    }
+    void* ptr = malloc(size > 0 ? size : 1);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
 
 class NapiExtTest : public NativeEngineTest {
 public:
@@ -596,6 +625,136 @@ HWTEST_F(NapiExtTest, TagObjectTest001, testing::ext::TestSize.Level1)
     ASSERT_CHECK_CALL(napi_check_object_type_tag(env, object, &typeTag, &checkResult));
     ASSERT_TRUE(checkResult);
 }
+
+/**
+ * @tc.name: TagObjectTest
+ * @tc.desc: Test type tags on wrapped class instances, a second tag is rejected and other tags do not match.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, TagObjectTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    const napi_type_tag typeTag = { 0xFFFFFFFFFFFFFFFF, 34ULL };
+    const napi_type_tag otherTag = { 0xFFFFFFFFFFFFFFFF, 35ULL };
+
+    auto constructor = [](napi_env env, napi_callback_info info) -> napi_value {
+        napi_value thisVar = nullptr;
+        napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+        return thisVar;
+    };
+    napi_value cls = nullptr;
+    ASSERT_CHECK_CALL(napi_define_class(env, "Tagged", NAPI_AUTO_LENGTH, constructor, nullptr, 0, nullptr, &cls));
+    napi_value instance = nullptr;
+    ASSERT_CHECK_CALL(napi_new_instance(env, cls, 0, nullptr, &instance));
+
+    bool checkResult = true;
+    ASSERT_CHECK_CALL(napi_check_object_type_tag(env, instance, &typeTag, &checkResult));
+    ASSERT_FALSE(checkResult);
+
+    ASSERT_CHECK_CALL(napi_type_tag_object(env, instance, &typeTag));
+    ASSERT_EQ(napi_type_tag_object(env, instance, &otherTag), napi_invalid_arg);
+
+    ASSERT_CHECK_CALL(napi_check_object_type_tag(env, instance, &typeTag, &checkResult));
+    ASSERT_TRUE(checkResult);
+    ASSERT_CHECK_CALL(napi_check_object_type_tag(env, instance, &otherTag, &checkResult));
+    ASSERT_FALSE(checkResult);
+
+    // Removing the wrap keeps the tag
+    int value = 0;
+    void* unwrapped = nullptr;
+    ASSERT_CHECK_CALL(napi_wrap(env, instance, &value, [](napi_env env, void* data, void* hint) {}, nullptr, nullptr));
+    ASSERT_CHECK_CALL(napi_remove_wrap(env, instance, &unwrapped));
+    ASSERT_EQ(unwrapped, &value);
+    ASSERT_CHECK_CALL(napi_check_object_type_tag(env, instance, &typeTag, &checkResult));
+    ASSERT_TRUE(checkResult);
+}
+
+/**
+ * @tc.name: WrapFunctionTest
+ * @tc.desc: Test that wrapping native functions and class constructors leaves them callable.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, WrapFunctionTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    static int finalizeCount = 0;
+    int data = 0;
+    auto finalize = [](NativeEngine* engine, void* data, void* hint) {
+        finalizeCount++;
+    };
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        napi_value thisVar = nullptr;
+        napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+        return thisVar;
+    };
+
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, "func", NAPI_AUTO_LENGTH, func, nullptr, &function));
+    napi_value cls = nullptr;
+    ASSERT_CHECK_CALL(napi_define_class(env, "Wrapped", NAPI_AUTO_LENGTH, func, nullptr, 0, nullptr, &cls));
+    for (napi_value target : { function, cls }) {
+        ASSERT_EQ(napi_wrap(env, target, &data, [](napi_env env, void* data, void* hint) {}, nullptr, nullptr),
+            napi_object_expected);
+        // Callers holding a NativeObject reach the engine without the type check
+        auto nativeObject = reinterpret_cast<NativeObject*>(
+            reinterpret_cast<NativeValue*>(target)->GetInterface(NativeObject::INTERFACE_ID));
+        ASSERT_NE(nativeObject, nullptr);
+        nativeObject->SetNativePointer(&data, finalize, nullptr);
+        ASSERT_EQ(nativeObject->GetNativePointer(), nullptr);
+    }
+
+    napi_value undefined = nullptr;
+    ASSERT_CHECK_CALL(napi_get_undefined(env, &undefined));
+    napi_value result = nullptr;
+    ASSERT_CHECK_CALL(napi_call_function(env, undefined, function, 0, nullptr, &result));
+    ASSERT_CHECK_CALL(napi_call_function(env, undefined, function, 0, nullptr, &result));
+    napi_value instance = nullptr;
+    ASSERT_CHECK_CALL(napi_new_instance(env, cls, 0, nullptr, &instance));
+    ASSERT_CHECK_CALL(napi_wrap(env, instance, &data, [](napi_env env, void* data, void* hint) {}, nullptr, nullptr));
+    void* unwrapped = nullptr;
+    ASSERT_CHECK_CALL(napi_unwrap(env, instance, &unwrapped));
+    ASSERT_EQ(unwrapped, &data);
+    ASSERT_CHECK_CALL(napi_new_instance(env, cls, 0, nullptr, &instance));
+    ASSERT_EQ(finalizeCount, 0);
+}
+
+/**
+ * @tc.name: TagObjectTest
+ * @tc.desc: Test type tags on native functions and class constructors, which keep running once tagged.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, TagObjectTest003, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    NapiTypeTag typeTag = { 0xFFFFFFFFFFFFFFFF, 36ULL };
+    NapiTypeTag otherTag = { 0xFFFFFFFFFFFFFFFF, 37ULL };
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        napi_value thisVar = nullptr;
+        napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+        return thisVar;
+    };
+
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, "func", NAPI_AUTO_LENGTH, func, nullptr, &function));
+    napi_value cls = nullptr;
+    ASSERT_CHECK_CALL(napi_define_class(env, "Tagged", NAPI_AUTO_LENGTH, func, nullptr, 0, nullptr, &cls));
+    for (napi_value target : { function, cls }) {
+        auto nativeObject = reinterpret_cast<NativeObject*>(
+            reinterpret_cast<NativeValue*>(target)->GetInterface(NativeObject::INTERFACE_ID));
+        ASSERT_NE(nativeObject, nullptr);
+        ASSERT_TRUE(nativeObject->AssociateTypeTag(&typeTag));
+        ASSERT_TRUE(nativeObject->CheckTypeTag(&typeTag));
+        ASSERT_FALSE(nativeObject->CheckTypeTag(&otherTag));
+    }
+
+    napi_value undefined = nullptr;
+    ASSERT_CHECK_CALL(napi_get_undefined(env, &undefined));
+    napi_value result = nullptr;
+    ASSERT_CHECK_CALL(napi_call_function(env, undefined, function, 0, nullptr, &result));
+    napi_value instance = nullptr;
+    ASSERT_CHECK_CALL(napi_new_instance(env, cls, 0, nullptr, &instance));
+    ASSERT_CHECK_VALUE_TYPE(env, instance, napi_object);
+}
 #endif
 
 HWTEST_F(NapiExtTest, GetDateTest001, testing::ext::TestSize.Level1)
@@ -780,6 +939,105 @@ HWTEST_F(NapiExtTest, OpenCallbackScopeTest002, testing::ext::TestSize.Level1)
     HILOG_INFO("ACE_napi_open_callback_scope_Test_002 end");
 }
 
+// Sets a microtask policy on the shared engine and restores the default one, also when an ASSERT returns early
+class MicrotaskPolicyGuard {
+public:
+    MicrotaskPolicyGuard(NativeEngine* engine, MicrotaskPolicy policy, uint32_t jobBudget = 0) : engine_(engine)
+    {
+        engine_->SetMicrotaskPolicy(policy, jobBudget);
+    }
+    ~MicrotaskPolicyGuard()
+    {
+        engine_->SetMicrotaskPolicy(MICROTASK_IMMEDIATE);
+    }
+
+private:
+    NativeEngine* engine_;
+};
+
+/**
+ * @tc.name: MicrotaskPolicyTest
+ * @tc.desc: Test pending jobs are drained when the outermost callback scope closes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, MicrotaskPolicyTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    MicrotaskPolicyGuard policyGuard(engine_, MICROTASK_SCOPED);
+
+    napi_value resourceName;
+    NAPI_CALL_RETURN_VOID(env, napi_create_string_utf8(env, "test", NAPI_AUTO_LENGTH, &resourceName));
+    napi_async_context context;
+    NAPI_CALL_RETURN_VOID(env, napi_async_init(env, nullptr, resourceName, &context));
+
+    napi_callback_scope outer = nullptr;
+    napi_callback_scope inner = nullptr;
+    ASSERT_EQ(napi_open_callback_scope(env, nullptr, context, &outer), napi_ok);
+    ASSERT_EQ(napi_open_callback_scope(env, nullptr, context, &inner), napi_ok);
+
+    const char* testScript = "var jobDone = false; Promise.resolve().then(() => { jobDone = true; });";
+    napi_value script = nullptr;
+    napi_value result = nullptr;
+    NAPI_CALL_RETURN_VOID(env, napi_create_string_utf8(env, testScript, NAPI_AUTO_LENGTH, &script));
+    NAPI_CALL_RETURN_VOID(env, napi_run_script(env, script, &result));
+
+    napi_value global = nullptr;
+    napi_value jobDone = nullptr;
+    bool done = true;
+    NAPI_CALL_RETURN_VOID(env, napi_get_global(env, &global));
+    NAPI_CALL_RETURN_VOID(env, napi_get_named_property(env, global, "jobDone", &jobDone));
+    NAPI_CALL_RETURN_VOID(env, napi_get_value_bool(env, jobDone, &done));
+    EXPECT_FALSE(done);
+
+    ASSERT_EQ(napi_close_callback_scope(env, inner), napi_ok);
+    NAPI_CALL_RETURN_VOID(env, napi_get_named_property(env, global, "jobDone", &jobDone));
+    NAPI_CALL_RETURN_VOID(env, napi_get_value_bool(env, jobDone, &done));
+    EXPECT_FALSE(done);
+
+    ASSERT_EQ(napi_close_callback_scope(env, outer), napi_ok);
+    NAPI_CALL_RETURN_VOID(env, napi_get_named_property(env, global, "jobDone", &jobDone));
+    NAPI_CALL_RETURN_VOID(env, napi_get_value_bool(env, jobDone, &done));
+    EXPECT_TRUE(done);
+
+    NAPI_CALL_RETURN_VOID(env, napi_async_destroy(env, context));
+}
+
+/**
+ * @tc.name: MicrotaskPolicyTest
+ * @tc.desc: Test batched pending jobs wait for the loop tick, which drains at most the job budget.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, MicrotaskPolicyTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    MicrotaskPolicyGuard policyGuard(engine_, MICROTASK_BATCHED, 1);
+
+    const char* testScript =
+        "var batchedJobs = 0;"
+        "Promise.resolve().then(() => { batchedJobs++; });"
+        "Promise.resolve().then(() => { batchedJobs++; });";
+    napi_value script = nullptr;
+    napi_value result = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, testScript, NAPI_AUTO_LENGTH, &script));
+    ASSERT_CHECK_CALL(napi_run_script(env, script, &result));
+
+    napi_value global = nullptr;
+    ASSERT_CHECK_CALL(napi_get_global(env, &global));
+    auto getJobCount = [env, global]() -> int32_t {
+        napi_value value = nullptr;
+        int32_t count = -1;
+        napi_get_named_property(env, global, "batchedJobs", &value);
+        napi_get_value_int32(env, value, &count);
+        return count;
+    };
+    ASSERT_EQ(getJobCount(), 0);
+
+    engine_->Loop(LOOP_NOWAIT);
+    ASSERT_EQ(getJobCount(), 1);
+    engine_->Loop(LOOP_NOWAIT);
+    ASSERT_EQ(getJobCount(), 2);
+}
+
 static napi_value TestFatalException(napi_env env, napi_callback_info info)
 {
     napi_value err;
@@ -821,3 +1079,865 @@ HWTEST_F(NapiExtTest, AddFinalizerTest001, testing::ext::TestSize.Level1)
     ASSERT_TRUE(testValue);
     HILOG_INFO("add_finalizer_test_0100 end");
 }
+
+/**
+ * @tc.name: AddFinalizerTest
+ * @tc.desc: Test that a finalizer is refused by native functions and class constructors, which still run afterwards.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, AddFinalizerTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    static int finalizeCount = 0;
+    auto finalize = [](NativeEngine* engine, void* data, void* hint) {
+        finalizeCount++;
+    };
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        napi_value thisVar = nullptr;
+        napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+        return thisVar;
+    };
+
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, "func", NAPI_AUTO_LENGTH, func, nullptr, &function));
+    napi_value cls = nullptr;
+    ASSERT_CHECK_CALL(napi_define_class(env, "Finalized", NAPI_AUTO_LENGTH, func, nullptr, 0, nullptr, &cls));
+    for (napi_value target : { function, cls }) {
+        auto nativeObject = reinterpret_cast<NativeObject*>(
+            reinterpret_cast<NativeValue*>(target)->GetInterface(NativeObject::INTERFACE_ID));
+        ASSERT_NE(nativeObject, nullptr);
+        nativeObject->AddFinalizer(nullptr, finalize, nullptr);
+    }
+
+    napi_value undefined = nullptr;
+    ASSERT_CHECK_CALL(napi_get_undefined(env, &undefined));
+    napi_value result = nullptr;
+    ASSERT_CHECK_CALL(napi_call_function(env, undefined, function, 0, nullptr, &result));
+    ASSERT_CHECK_CALL(napi_call_function(env, undefined, function, 0, nullptr, &result));
+    napi_value instance = nullptr;
+    ASSERT_CHECK_CALL(napi_new_instance(env, cls, 0, nullptr, &instance));
+    ASSERT_CHECK_CALL(napi_new_instance(env, cls, 0, nullptr, &instance));
+    ASSERT_CHECK_VALUE_TYPE(env, instance, napi_object);
+    ASSERT_EQ(finalizeCount, 0);
+}
+
+/**
+ * @tc.name: EncodeToUtf8Test
+ * @tc.desc: Test that the QuickJS EncodeToUtf8 keeps surrogate pairs whole.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, EncodeToUtf8Test001, testing::ext::TestSize.Level1)
+{
+    std::string str = "a\xf0\x9f\x98\x80b";
+    auto testStr = engine_->CreateString(str.c_str(), str.length());
+    char buffer[8] = { 0 };
+    int32_t written = 0;
+    int32_t nchars = 0;
+    engine_->EncodeToUtf8(testStr, buffer, &written, str.length(), &nchars);
+    ASSERT_EQ(written, 6);
+    ASSERT_EQ(nchars, 4);
+    ASSERT_EQ(memcmp(buffer, str.c_str(), str.length()), 0);
+
+    engine_->EncodeToUtf8(testStr, buffer, &written, 4, &nchars);
+    ASSERT_EQ(written, 1);
+    ASSERT_EQ(nchars, 1);
+}
+
+/**
+ * @tc.name: StringViewTest
+ * @tc.desc: Test napi_get_value_string_utf8_view.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, StringViewTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+
+    napi_handle_scope scope = nullptr;
+    NAPI_CALL_RETURN_VOID(env, napi_open_handle_scope(env, &scope));
+
+    const char* testStr[] = { "ascii view", "中文,English,123456" };
+    for (const char* str : testStr) {
+        napi_value value = nullptr;
+        NAPI_CALL_RETURN_VOID(env, napi_create_string_utf8(env, str, NAPI_AUTO_LENGTH, &value));
+
+        const char* view = nullptr;
+        size_t length = 0;
+        ASSERT_EQ(napi_get_value_string_utf8_view(env, value, &view, &length), napi_ok);
+        ASSERT_NE(view, nullptr);
+        ASSERT_EQ(length, strlen(str));
+        ASSERT_EQ(strncmp(view, str, length), 0);
+
+        const char* again = nullptr;
+        ASSERT_EQ(napi_get_value_string_utf8_view(env, value, &again, &length), napi_ok);
+        ASSERT_EQ(again, view);
+    }
+
+    napi_value number = nullptr;
+    const char* view = nullptr;
+    size_t length = 0;
+    NAPI_CALL_RETURN_VOID(env, napi_create_int32(env, 1, &number));
+    ASSERT_EQ(napi_get_value_string_utf8_view(env, number, &view, &length), napi_string_expected);
+
+    NAPI_CALL_RETURN_VOID(env, napi_close_handle_scope(env, scope));
+}
+
+/**
+ * @tc.name: StringLatin1Test
+ * @tc.desc: Test napi_create_string_latin1 with bytes above 0x7F.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, StringLatin1Test001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    const char testStr[] = "caf\xe9 na\xefve";
+    const char expectStr[] = "caf\xc3\xa9 na\xc3\xafve";
+
+    napi_value result = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_latin1(env, testStr, NAPI_AUTO_LENGTH, &result));
+    ASSERT_CHECK_VALUE_TYPE(env, result, napi_string);
+
+    char buffer[NAPI_UT_BUFFER_SIZE] = { 0 };
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_get_value_string_utf8(env, result, buffer, sizeof(buffer), &length));
+    ASSERT_EQ(length, strlen(expectStr));
+    ASSERT_STREQ(buffer, expectStr);
+}
+
+/**
+ * @tc.name: ExternalStringTest
+ * @tc.desc: Test napi_create_external_string_latin1 and napi_create_external_string_utf16.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, ExternalStringTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    static int finalizeCount = 0;
+    finalizeCount = 0;
+    auto finalizer = [](napi_env env, void* data, void* hint) {
+        finalizeCount++;
+    };
+
+    char latin1Str[] = "external latin1";
+    napi_value latin1Value = nullptr;
+    bool copied = false;
+    ASSERT_CHECK_CALL(napi_create_external_string_latin1(
+        env, latin1Str, NAPI_AUTO_LENGTH, finalizer, nullptr, &latin1Value, &copied));
+    ASSERT_CHECK_VALUE_TYPE(env, latin1Value, napi_string);
+    if (copied) {
+        ASSERT_EQ(finalizeCount, 1);
+    }
+
+    char buffer[NAPI_UT_BUFFER_SIZE] = { 0 };
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_get_value_string_utf8(env, latin1Value, buffer, sizeof(buffer), &length));
+    ASSERT_STREQ(buffer, latin1Str);
+
+    char16_t utf16Str[] = u"external 中文";
+    size_t utf16Length = std::char_traits<char16_t>::length(utf16Str);
+    napi_value utf16Value = nullptr;
+    ASSERT_CHECK_CALL(napi_create_external_string_utf16(
+        env, utf16Str, utf16Length, finalizer, nullptr, &utf16Value, &copied));
+    ASSERT_CHECK_VALUE_TYPE(env, utf16Value, napi_string);
+
+    char16_t buffer16[NAPI_UT_BUFFER_SIZE] = { 0 };
+    ASSERT_CHECK_CALL(napi_get_value_string_utf16(env, utf16Value, buffer16, NAPI_UT_BUFFER_SIZE, &length));
+    ASSERT_EQ(length, utf16Length);
+    ASSERT_EQ(std::char_traits<char16_t>::compare(buffer16, utf16Str, utf16Length), 0);
+}
+
+/**
+ * @tc.name: PropertyKeyTest
+ * @tc.desc: Test napi_create_property_key, napi_set_property_by_key and napi_get_property_by_key.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, PropertyKeyTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+
+    napi_property_key key = nullptr;
+    ASSERT_CHECK_CALL(napi_create_property_key(env, "count", &key));
+    ASSERT_NE(key, nullptr);
+
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    for (int32_t i = 0; i < 3; i++) {
+        napi_value value = nullptr;
+        ASSERT_CHECK_CALL(napi_create_int32(env, i, &value));
+        ASSERT_CHECK_CALL(napi_set_property_by_key(env, object, key, value));
+    }
+
+    napi_value result = nullptr;
+    int32_t count = 0;
+    ASSERT_CHECK_CALL(napi_get_property_by_key(env, object, key, &result));
+    ASSERT_CHECK_CALL(napi_get_value_int32(env, result, &count));
+    ASSERT_EQ(count, 2);
+
+    bool hasProperty = false;
+    ASSERT_CHECK_CALL(napi_has_named_property(env, object, "count", &hasProperty));
+    ASSERT_TRUE(hasProperty);
+
+    napi_value number = nullptr;
+    ASSERT_CHECK_CALL(napi_create_int32(env, 0, &number));
+    ASSERT_EQ(napi_get_property_by_key(env, number, key, &result), napi_object_expected);
+
+    ASSERT_CHECK_CALL(napi_delete_property_key(env, key));
+}
+
+/**
+ * @tc.name: ElementsTest
+ * @tc.desc: Test bulk array element access.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, ElementsTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    constexpr uint32_t elementCount = 4;
+
+    napi_value array = nullptr;
+    ASSERT_CHECK_CALL(napi_create_array(env, &array));
+
+    const int32_t ints[elementCount] = { 1, -2, 3, INT32_MAX };
+    ASSERT_CHECK_CALL(napi_set_elements_int32(env, array, 0, elementCount, ints));
+    int32_t intResult[elementCount] = { 0 };
+    ASSERT_CHECK_CALL(napi_get_elements_int32(env, array, 0, elementCount, intResult));
+    for (uint32_t i = 0; i < elementCount; i++) {
+        ASSERT_EQ(intResult[i], ints[i]);
+    }
+
+    const double doubles[elementCount] = { 0.5, -1.25, 3.0, 1e100 };
+    ASSERT_CHECK_CALL(napi_set_elements_double(env, array, elementCount, elementCount, doubles));
+    uint32_t length = 0;
+    ASSERT_CHECK_CALL(napi_get_array_length(env, array, &length));
+    ASSERT_EQ(length, elementCount * 2);
+    double doubleResult[elementCount] = { 0 };
+    ASSERT_CHECK_CALL(napi_get_elements_double(env, array, elementCount, elementCount, doubleResult));
+    for (uint32_t i = 0; i < elementCount; i++) {
+        ASSERT_EQ(doubleResult[i], doubles[i]);
+    }
+
+    napi_value values[elementCount] = { nullptr };
+    ASSERT_CHECK_CALL(napi_get_elements(env, array, 0, elementCount, values));
+    for (uint32_t i = 0; i < elementCount; i++) {
+        int32_t value = 0;
+        ASSERT_CHECK_CALL(napi_get_value_int32(env, values[i], &value));
+        ASSERT_EQ(value, ints[i]);
+    }
+
+    const char* strs[elementCount] = { "", "abc", "中文", "mixed 中文" };
+    for (uint32_t i = 0; i < elementCount; i++) {
+        ASSERT_CHECK_CALL(napi_create_string_utf8(env, strs[i], NAPI_AUTO_LENGTH, &values[i]));
+    }
+    ASSERT_CHECK_CALL(napi_set_elements(env, array, 0, elementCount, values));
+    const char* strResult[elementCount] = { nullptr };
+    size_t strLengths[elementCount] = { 0 };
+    ASSERT_CHECK_CALL(napi_get_elements_string_utf8_view(env, array, 0, elementCount, strResult, strLengths));
+    for (uint32_t i = 0; i < elementCount; i++) {
+        ASSERT_EQ(strLengths[i], strlen(strs[i]));
+        ASSERT_STREQ(strResult[i], strs[i]);
+    }
+
+    ASSERT_EQ(napi_get_elements_double(env, array, 0, elementCount, doubleResult), napi_number_expected);
+    ASSERT_EQ(napi_get_elements_string_utf8_view(env, array, 0, elementCount + 1, strResult, strLengths),
+        napi_string_expected);
+
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    ASSERT_EQ(napi_get_elements(env, object, 0, elementCount, values), napi_array_expected);
+
+    // a throwing getter fails the read instead of handing out the exception as an element
+    const char* testScript = "var thrower = [1]; Object.defineProperty(thrower, 1, { get() { throw 1; } }); thrower;";
+    napi_value script = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, testScript, NAPI_AUTO_LENGTH, &script));
+    napi_value thrower = nullptr;
+    ASSERT_CHECK_CALL(napi_run_script(env, script, &thrower));
+    ASSERT_EQ(napi_get_elements(env, thrower, 0, 2, values), napi_generic_failure);
+    bool isExceptionPending = false;
+    ASSERT_CHECK_CALL(napi_is_exception_pending(env, &isExceptionPending));
+    ASSERT_TRUE(isExceptionPending);
+    napi_value exception = nullptr;
+    ASSERT_CHECK_CALL(napi_get_and_clear_last_exception(env, &exception));
+}
+
+/**
+ * @tc.name: ObjectWithPropertiesTest
+ * @tc.desc: Test napi_create_object_with_properties.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, ObjectWithPropertiesTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+
+    const char* names[] = { "id", "name" };
+    napi_value values[2] = { nullptr };
+    ASSERT_CHECK_CALL(napi_create_int32(env, 7, &values[0]));
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, "record", NAPI_AUTO_LENGTH, &values[1]));
+
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object_with_properties(env, nullptr, names, values, 2, &object));
+    ASSERT_CHECK_VALUE_TYPE(env, object, napi_object);
+
+    napi_value id = nullptr;
+    int32_t idValue = 0;
+    ASSERT_CHECK_CALL(napi_get_named_property(env, object, "id", &id));
+    ASSERT_CHECK_CALL(napi_get_value_int32(env, id, &idValue));
+    ASSERT_EQ(idValue, 7);
+
+    napi_value name = nullptr;
+    char buffer[NAPI_UT_BUFFER_SIZE] = { 0 };
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_get_named_property(env, object, "name", &name));
+    ASSERT_CHECK_CALL(napi_get_value_string_utf8(env, name, buffer, sizeof(buffer), &length));
+    ASSERT_STREQ(buffer, "record");
+
+    napi_value prototype = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object_with_properties(env, nullptr, names, values, 1, &prototype));
+    napi_value derived = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object_with_properties(env, prototype, &names[1], &values[1], 1, &derived));
+    napi_value idKey = nullptr;
+    bool hasOwnId = true;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, "id", NAPI_AUTO_LENGTH, &idKey));
+    ASSERT_CHECK_CALL(napi_has_own_property(env, derived, idKey, &hasOwnId));
+    ASSERT_FALSE(hasOwnId);
+    ASSERT_CHECK_CALL(napi_get_named_property(env, derived, "id", &id));
+    ASSERT_CHECK_CALL(napi_get_value_int32(env, id, &idValue));
+    ASSERT_EQ(idValue, 7);
+
+    ASSERT_EQ(napi_create_object_with_properties(env, values[0], names, values, 2, &object), napi_object_expected);
+}
+
+/**
+ * @tc.name: ObjectTemplateTest
+ * @tc.desc: Test napi_create_object_template and napi_new_object_from_template.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, ObjectTemplateTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+
+    const char* names[] = { "x", "y" };
+    napi_object_template objectTemplate = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object_template(env, names, 2, &objectTemplate));
+
+    for (int32_t i = 0; i < 3; i++) {
+        napi_value values[2] = { nullptr };
+        ASSERT_CHECK_CALL(napi_create_int32(env, i, &values[0]));
+        ASSERT_CHECK_CALL(napi_create_int32(env, -i, &values[1]));
+
+        napi_value object = nullptr;
+        ASSERT_CHECK_CALL(napi_new_object_from_template(env, objectTemplate, values, &object));
+        ASSERT_CHECK_VALUE_TYPE(env, object, napi_object);
+
+        napi_value y = nullptr;
+        int32_t yValue = 0;
+        ASSERT_CHECK_CALL(napi_get_named_property(env, object, "y", &y));
+        ASSERT_CHECK_CALL(napi_get_value_int32(env, y, &yValue));
+        ASSERT_EQ(yValue, -i);
+
+        napi_value propertyNames = nullptr;
+        uint32_t length = 0;
+        ASSERT_CHECK_CALL(napi_get_property_names(env, object, &propertyNames));
+        ASSERT_CHECK_CALL(napi_get_array_length(env, propertyNames, &length));
+        ASSERT_EQ(length, 2);
+    }
+
+    ASSERT_EQ(napi_new_object_from_template(env, objectTemplate, nullptr, nullptr), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_delete_object_template(env, objectTemplate));
+}
+
+/**
+ * @tc.name: TypeOfTest
+ * @tc.desc: Test napi_typeof on values created natively and values coming back from the engine.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, TypeOfTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+
+    napi_value value = nullptr;
+    ASSERT_CHECK_CALL(napi_get_null(env, &value));
+    ASSERT_CHECK_VALUE_TYPE(env, value, napi_null);
+    ASSERT_CHECK_CALL(napi_get_undefined(env, &value));
+    ASSERT_CHECK_VALUE_TYPE(env, value, napi_undefined);
+    ASSERT_CHECK_CALL(napi_get_boolean(env, true, &value));
+    ASSERT_CHECK_VALUE_TYPE(env, value, napi_boolean);
+    ASSERT_CHECK_CALL(napi_create_double(env, 1.5, &value));
+    ASSERT_CHECK_VALUE_TYPE(env, value, napi_number);
+    ASSERT_CHECK_CALL(napi_create_bigint_int64(env, 1, &value));
+    ASSERT_CHECK_VALUE_TYPE(env, value, napi_bigint);
+
+    napi_value description = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, "symbol", NAPI_AUTO_LENGTH, &description));
+    ASSERT_CHECK_VALUE_TYPE(env, description, napi_string);
+    ASSERT_CHECK_CALL(napi_create_symbol(env, description, &value));
+    ASSERT_CHECK_VALUE_TYPE(env, value, napi_symbol);
+
+    ASSERT_CHECK_CALL(napi_create_external(env, nullptr, nullptr, nullptr, &value));
+    ASSERT_CHECK_VALUE_TYPE(env, value, napi_external);
+
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        return nullptr;
+    };
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, "func", NAPI_AUTO_LENGTH, func, nullptr, &function));
+    ASSERT_CHECK_VALUE_TYPE(env, function, napi_function);
+
+    napi_value array = nullptr;
+    ASSERT_CHECK_CALL(napi_create_array(env, &array));
+    ASSERT_CHECK_VALUE_TYPE(env, array, napi_object);
+
+    // values read back from the engine are classified by the conversion
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, object, "func", function));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, object, "array", array));
+    ASSERT_CHECK_CALL(napi_get_named_property(env, object, "func", &value));
+    ASSERT_CHECK_VALUE_TYPE(env, value, napi_function);
+    ASSERT_CHECK_CALL(napi_get_named_property(env, object, "array", &value));
+    ASSERT_CHECK_VALUE_TYPE(env, value, napi_object);
+    ASSERT_CHECK_CALL(napi_get_named_property(env, object, "missing", &value));
+    ASSERT_CHECK_VALUE_TYPE(env, value, napi_undefined);
+}
+
+static size_t CountCallAllocations(napi_env env, napi_value recv, napi_value function, size_t argc,
+                                   const napi_value* argv)
+{
+    napi_handle_scope scope = nullptr;
+    napi_open_handle_scope(env, &scope);
+    size_t before = g_allocationCount;
+    g_countAllocations = true;
+    napi_value result = nullptr;
+    napi_call_function(env, recv, function, argc, argv, &result);
+    g_countAllocations = false;
+    size_t count = g_allocationCount - before;
+    napi_close_handle_scope(env, scope);
+    return count;
+}
+
+/**
+ * @tc.name: CallArgumentAllocationTest
+ * @tc.desc: Test that calls with up to 8 arguments take no more heap allocations than a call without arguments.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, CallArgumentAllocationTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        return nullptr;
+    };
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, "func", NAPI_AUTO_LENGTH, func, nullptr, &function));
+    napi_value recv = nullptr;
+    ASSERT_CHECK_CALL(napi_get_undefined(env, &recv));
+    napi_value argv[NAPI_UT_INLINE_ARGUMENT_COUNT] = { nullptr };
+    for (size_t i = 0; i < NAPI_UT_INLINE_ARGUMENT_COUNT; i++) {
+        ASSERT_CHECK_CALL(napi_create_uint32(env, i, &argv[i]));
+    }
+
+    // Warm up once so lazily created engine state is not counted
+    CountCallAllocations(env, recv, function, NAPI_UT_INLINE_ARGUMENT_COUNT, argv);
+
+    // The callback reads no argument, so none is wrapped and no argument adds an allocation
+    size_t previous = CountCallAllocations(env, recv, function, 0, argv);
+    for (size_t argc = 1; argc <= NAPI_UT_INLINE_ARGUMENT_COUNT; argc++) {
+        size_t current = CountCallAllocations(env, recv, function, argc, argv);
+        size_t perArgument = current - previous;
+        ASSERT_EQ(perArgument, 0);
+        previous = current;
+    }
+}
+
+/**
+ * @tc.name: ObjectIdentityHashTest
+ * @tc.desc: Test that an object keeps its identity hash and that primitives are rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, ObjectIdentityHashTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(
+        env, "func", NAPI_AUTO_LENGTH, [](napi_env env, napi_callback_info info) -> napi_value { return nullptr; },
+        nullptr, &function));
+
+    uint32_t objectHash = 0;
+    uint32_t hash = 0;
+    ASSERT_CHECK_CALL(napi_get_object_identity_hash(env, object, &objectHash));
+    ASSERT_CHECK_CALL(napi_get_object_identity_hash(env, object, &hash));
+    ASSERT_EQ(hash, objectHash);
+
+    // A property write must not change the hash
+    napi_value value = nullptr;
+    ASSERT_CHECK_CALL(napi_create_int32(env, 1, &value));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, object, "value", value));
+    ASSERT_CHECK_CALL(napi_get_object_identity_hash(env, object, &hash));
+    ASSERT_EQ(hash, objectHash);
+
+    uint32_t functionHash = 0;
+    ASSERT_CHECK_CALL(napi_get_object_identity_hash(env, function, &functionHash));
+    ASSERT_CHECK_CALL(napi_get_object_identity_hash(env, function, &hash));
+    ASSERT_EQ(hash, functionHash);
+
+    ASSERT_EQ(napi_get_object_identity_hash(env, value, &hash), napi_object_expected);
+}
+
+/**
+ * @tc.name: CreateTypedArrayTest
+ * @tc.desc: Test that typed arrays and data views do not depend on the current global constructors.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, CreateTypedArrayTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_value global = nullptr;
+    ASSERT_CHECK_CALL(napi_get_global(env, &global));
+    napi_value uint8Array = nullptr;
+    ASSERT_CHECK_CALL(napi_get_named_property(env, global, "Uint8Array", &uint8Array));
+    napi_value dataView = nullptr;
+    ASSERT_CHECK_CALL(napi_get_named_property(env, global, "DataView", &dataView));
+
+    napi_value undefined = nullptr;
+    ASSERT_CHECK_CALL(napi_get_undefined(env, &undefined));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, global, "Uint8Array", undefined));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, global, "DataView", undefined));
+
+    void* data = nullptr;
+    napi_value arrayBuffer = nullptr;
+    ASSERT_CHECK_CALL(napi_create_arraybuffer(env, NAPI_UT_BUFFER_SIZE, &data, &arrayBuffer));
+    napi_value typedArray = nullptr;
+    napi_status typedArrayStatus = napi_create_typedarray(env, napi_uint8_array, 1, arrayBuffer, 1, &typedArray);
+    napi_value view = nullptr;
+    napi_status viewStatus = napi_create_dataview(env, 1, arrayBuffer, 1, &view);
+
+    ASSERT_CHECK_CALL(napi_set_named_property(env, global, "Uint8Array", uint8Array));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, global, "DataView", dataView));
+
+    ASSERT_EQ(typedArrayStatus, napi_ok);
+    bool isTypedArray = false;
+    ASSERT_CHECK_CALL(napi_is_typedarray(env, typedArray, &isTypedArray));
+    ASSERT_TRUE(isTypedArray);
+    ASSERT_EQ(viewStatus, napi_ok);
+    bool isDataView = false;
+    ASSERT_CHECK_CALL(napi_is_dataview(env, view, &isDataView));
+    ASSERT_TRUE(isDataView);
+}
+
+/**
+ * @tc.name: BufferPoolTest
+ * @tc.desc: Test that small Buffers sharing pooled storage are zero-filled, sized and independent.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, BufferPoolTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    constexpr size_t bufferCount = 4;
+    constexpr size_t bufferSize = 13;
+    constexpr uint8_t fill = 0xA5;
+
+    napi_value buffers[bufferCount] = { nullptr };
+    uint8_t* data[bufferCount] = { nullptr };
+    for (size_t i = 0; i < bufferCount; i++) {
+        ASSERT_CHECK_CALL(napi_create_buffer(env, bufferSize, reinterpret_cast<void**>(&data[i]), &buffers[i]));
+        ASSERT_NE(data[i], nullptr);
+        for (size_t j = 0; j < bufferSize; j++) {
+            ASSERT_EQ(data[i][j], 0);
+        }
+        memset_s(data[i], bufferSize, fill, bufferSize);
+    }
+
+    for (size_t i = 0; i < bufferCount; i++) {
+        bool isBuffer = false;
+        ASSERT_CHECK_CALL(napi_is_buffer(env, buffers[i], &isBuffer));
+        ASSERT_TRUE(isBuffer);
+        void* bufferData = nullptr;
+        size_t bufferLength = 0;
+        ASSERT_CHECK_CALL(napi_get_buffer_info(env, buffers[i], &bufferData, &bufferLength));
+        ASSERT_EQ(bufferData, data[i]);
+        ASSERT_EQ(bufferLength, bufferSize);
+        for (size_t j = 0; j < bufferSize; j++) {
+            ASSERT_EQ(data[i][j], fill);
+        }
+    }
+
+    const char copySource[] = "pooled";
+    void* copyData = nullptr;
+    napi_value copy = nullptr;
+    ASSERT_CHECK_CALL(napi_create_buffer_copy(env, sizeof(copySource), copySource, &copyData, &copy));
+    ASSERT_EQ(memcmp(copyData, copySource, sizeof(copySource)), 0);
+}
+
+/**
+ * @tc.name: BufferPoolTest
+ * @tc.desc: Test that detaching a pooled Buffer leaves the Buffers sharing its storage intact.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, BufferPoolTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    constexpr size_t bufferSize = 16;
+    constexpr uint8_t fill = 0x5A;
+    napi_handle_scope scope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &scope));
+
+    uint8_t* keptData = nullptr;
+    napi_value kept = nullptr;
+    ASSERT_CHECK_CALL(napi_create_buffer(env, bufferSize, reinterpret_cast<void**>(&keptData), &kept));
+    memset_s(keptData, bufferSize, fill, bufferSize);
+
+    // the detached Buffer shares the kept one's slab and is collected when its scope closes
+    napi_handle_scope detachScope = nullptr;
+    ASSERT_CHECK_CALL(napi_open_handle_scope(env, &detachScope));
+    void* detachedData = nullptr;
+    napi_value detached = nullptr;
+    ASSERT_CHECK_CALL(napi_create_buffer(env, bufferSize, &detachedData, &detached));
+    // read it back through the engine, which wraps a Buffer's storage as an ArrayBuffer
+    napi_value holder = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &holder));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, holder, "buffer", detached));
+    ASSERT_CHECK_CALL(napi_get_named_property(env, holder, "buffer", &detached));
+    ASSERT_CHECK_CALL(napi_detach_arraybuffer(env, detached));
+    bool isDetached = false;
+    ASSERT_CHECK_CALL(napi_is_detached_arraybuffer(env, detached, &isDetached));
+    ASSERT_TRUE(isDetached);
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, detachScope));
+
+    // fill several slabs, a slab released too early would be reused and zero-filled under the kept Buffer
+    constexpr size_t bufferCount = 2048;
+    for (size_t i = 0; i < bufferCount; i++) {
+        napi_handle_scope loopScope = nullptr;
+        ASSERT_CHECK_CALL(napi_open_handle_scope(env, &loopScope));
+        void* data = nullptr;
+        napi_value buffer = nullptr;
+        ASSERT_CHECK_CALL(napi_create_buffer(env, bufferSize, &data, &buffer));
+        ASSERT_CHECK_CALL(napi_close_handle_scope(env, loopScope));
+    }
+    for (size_t i = 0; i < bufferSize; i++) {
+        ASSERT_EQ(keptData[i], fill);
+    }
+
+    ASSERT_CHECK_CALL(napi_close_handle_scope(env, scope));
+}
+
+/**
+ * @tc.name: ArrayBufferFromFileTest
+ * @tc.desc: Test mapping part of a file into an ArrayBuffer, writes through the buffer must not reach the file.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, ArrayBufferFromFileTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    constexpr size_t fileSize = 10000;
+    constexpr size_t mapOffset = 5000;
+    constexpr size_t mapLength = 100;
+    constexpr uint8_t byteModulus = 251;
+
+    char path[] = "./napi_mapped_file_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    uint8_t content[fileSize] = { 0 };
+    for (size_t i = 0; i < fileSize; i++) {
+        content[i] = static_cast<uint8_t>(i % byteModulus);
+    }
+    ASSERT_EQ(write(fd, content, fileSize), static_cast<ssize_t>(fileSize));
+    close(fd);
+
+    napi_value arrayBuffer = nullptr;
+    ASSERT_CHECK_CALL(napi_create_arraybuffer_from_file(
+        env, path, mapOffset, mapLength, napi_file_mapping_copy_on_write, &arrayBuffer));
+    uint8_t* data = nullptr;
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_get_arraybuffer_info(env, arrayBuffer, reinterpret_cast<void**>(&data), &length));
+    ASSERT_EQ(length, mapLength);
+    ASSERT_EQ(memcmp(data, content + mapOffset, mapLength), 0);
+    data[0] = static_cast<uint8_t>(~data[0]);
+
+    napi_value whole = nullptr;
+    ASSERT_CHECK_CALL(napi_create_arraybuffer_from_file(env, path, 0, 0, napi_file_mapping_copy_on_write, &whole));
+    ASSERT_CHECK_CALL(napi_get_arraybuffer_info(env, whole, reinterpret_cast<void**>(&data), &length));
+    ASSERT_EQ(length, fileSize);
+    ASSERT_EQ(memcmp(data, content, fileSize), 0);
+    data[mapOffset] = static_cast<uint8_t>(~data[mapOffset]);
+
+    uint8_t fileContent[fileSize] = { 0 };
+    fd = open(path, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(read(fd, fileContent, fileSize), static_cast<ssize_t>(fileSize));
+    close(fd);
+    ASSERT_EQ(memcmp(fileContent, content, fileSize), 0);
+
+    napi_value invalid = nullptr;
+    ASSERT_EQ(napi_create_arraybuffer_from_file(env, path, fileSize, 1, napi_file_mapping_copy_on_write, &invalid),
+        napi_invalid_arg);
+    ASSERT_EQ(napi_create_arraybuffer_from_file(env, path, 0, 0, napi_file_mapping_read_only, &invalid),
+        napi_invalid_arg);
+    unlink(path);
+
+    char fifoPath[] = "./napi_mapped_fifo_XXXXXX";
+    fd = mkstemp(fifoPath);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    unlink(fifoPath);
+    ASSERT_EQ(mkfifo(fifoPath, S_IRUSR | S_IWUSR), 0);
+    ASSERT_EQ(napi_create_arraybuffer_from_file(env, fifoPath, 0, 0, napi_file_mapping_copy_on_write, &invalid),
+        napi_invalid_arg);
+    unlink(fifoPath);
+}
+
+/**
+ * @tc.name: TransferArrayBufferTest
+ * @tc.desc: Test transferring ArrayBuffers held by the message and by its properties, the originals are detached.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, TransferArrayBufferTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    constexpr size_t bufferSize = 64;
+    constexpr uint8_t fill = 0x5a;
+    constexpr int32_t tagValue = 7;
+
+    void* data = nullptr;
+    napi_value arrayBuffer = nullptr;
+    ASSERT_CHECK_CALL(napi_create_arraybuffer(env, bufferSize, &data, &arrayBuffer));
+    memset_s(data, bufferSize, fill, bufferSize);
+    napi_value message = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &message));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, message, "data", arrayBuffer));
+    napi_value tag = nullptr;
+    ASSERT_CHECK_CALL(napi_create_int32(env, tagValue, &tag));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, message, "tag", tag));
+    napi_value transferList = nullptr;
+    ASSERT_CHECK_CALL(napi_create_array_with_length(env, 1, &transferList));
+    ASSERT_CHECK_CALL(napi_set_element(env, transferList, 0, arrayBuffer));
+
+    napi_value serialized = nullptr;
+    ASSERT_CHECK_CALL(napi_serialize(env, message, transferList, &serialized));
+    ASSERT_NE(serialized, nullptr);
+    bool isDetached = false;
+    ASSERT_CHECK_CALL(napi_is_detached_arraybuffer(env, arrayBuffer, &isDetached));
+    ASSERT_TRUE(isDetached);
+
+    napi_value result = nullptr;
+    ASSERT_CHECK_CALL(napi_deserialize(env, serialized, &result));
+    ASSERT_CHECK_CALL(napi_delete_serialization_data(env, serialized));
+    napi_value received = nullptr;
+    ASSERT_CHECK_CALL(napi_get_named_property(env, result, "data", &received));
+    uint8_t* receivedData = nullptr;
+    size_t receivedLength = 0;
+    ASSERT_CHECK_CALL(
+        napi_get_arraybuffer_info(env, received, reinterpret_cast<void**>(&receivedData), &receivedLength));
+    ASSERT_EQ(receivedLength, bufferSize);
+    for (size_t i = 0; i < bufferSize; i++) {
+        ASSERT_EQ(receivedData[i], fill);
+    }
+    napi_value receivedTag = nullptr;
+    ASSERT_CHECK_CALL(napi_get_named_property(env, result, "tag", &receivedTag));
+    int32_t tagResult = 0;
+    ASSERT_CHECK_CALL(napi_get_value_int32(env, receivedTag, &tagResult));
+    ASSERT_EQ(tagResult, tagValue);
+
+    // The message itself transferred
+    ASSERT_CHECK_CALL(napi_set_element(env, transferList, 0, received));
+    ASSERT_CHECK_CALL(napi_serialize(env, received, transferList, &serialized));
+    ASSERT_CHECK_CALL(napi_deserialize(env, serialized, &result));
+    ASSERT_CHECK_CALL(napi_delete_serialization_data(env, serialized));
+    ASSERT_CHECK_CALL(napi_get_arraybuffer_info(env, result, reinterpret_cast<void**>(&receivedData), &receivedLength));
+    ASSERT_EQ(receivedLength, bufferSize);
+    ASSERT_EQ(receivedData[0], fill);
+}
+
+/**
+ * @tc.name: TypeOfTest
+ * @tc.desc: Test napi_typeof on typed arrays and data views whose construction threw.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, TypeOfTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+
+    void* data = nullptr;
+    napi_value arrayBuffer = nullptr;
+    ASSERT_CHECK_CALL(napi_create_arraybuffer(env, 4, &data, &arrayBuffer));
+
+    // both views extend past the end of the buffer, so the constructors throw a RangeError
+    napi_value typedArray = nullptr;
+    ASSERT_CHECK_CALL(napi_create_typedarray(env, napi_int32_array, 8, arrayBuffer, 0, &typedArray));
+    ASSERT_CHECK_VALUE_TYPE(env, typedArray, napi_undefined);
+    bool isExceptionPending = false;
+    ASSERT_CHECK_CALL(napi_is_exception_pending(env, &isExceptionPending));
+    ASSERT_TRUE(isExceptionPending);
+    napi_value exception = nullptr;
+    ASSERT_CHECK_CALL(napi_get_and_clear_last_exception(env, &exception));
+
+    napi_value dataView = nullptr;
+    ASSERT_CHECK_CALL(napi_create_dataview(env, 8, arrayBuffer, 0, &dataView));
+    ASSERT_CHECK_VALUE_TYPE(env, dataView, napi_undefined);
+    ASSERT_CHECK_CALL(napi_is_exception_pending(env, &isExceptionPending));
+    ASSERT_TRUE(isExceptionPending);
+    ASSERT_CHECK_CALL(napi_get_and_clear_last_exception(env, &exception));
+}
+
+/**
+ * @tc.name: DefineClassTest
+ * @tc.desc: Test constructing a native class directly and through a script subclass, its prototype methods,
+ *           instanceof, and the TypeError when it is called without new.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiExtTest, DefineClassTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+
+    auto constructor = [](napi_env env, napi_callback_info info) -> napi_value {
+        size_t argc = 1;
+        napi_value argv[1] = { nullptr };
+        napi_value thisVar = nullptr;
+        NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr));
+        NAPI_CALL(env, napi_set_named_property(env, thisVar, "count", argv[0]));
+        return thisVar;
+    };
+    auto getCount = [](napi_env env, napi_callback_info info) -> napi_value {
+        napi_value thisVar = nullptr;
+        NAPI_CALL(env, napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr));
+        napi_value count = nullptr;
+        NAPI_CALL(env, napi_get_named_property(env, thisVar, "count", &count));
+        return count;
+    };
+    napi_property_descriptor descriptors[] = {
+        DECLARE_NAPI_FUNCTION("getCount", getCount),
+    };
+    napi_value cls = nullptr;
+    ASSERT_CHECK_CALL(napi_define_class(env, "NativeCounter", NAPI_AUTO_LENGTH, constructor, nullptr,
+        sizeof(descriptors) / sizeof(descriptors[0]), descriptors, &cls));
+    napi_value global = nullptr;
+    ASSERT_CHECK_CALL(napi_get_global(env, &global));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, global, "NativeCounter", cls));
+
+    const char* testScript =
+        "class ScriptCounter extends NativeCounter {"
+        "    constructor() { super(7); this.sub = true; }"
+        "    twice() { return this.getCount() * 2; }"
+        "}"
+        "var sub = new ScriptCounter();"
+        "var base = new NativeCounter(3);"
+        "sub instanceof ScriptCounter && sub instanceof NativeCounter && sub.sub === true && sub.twice() === 14 &&"
+        "    Object.getPrototypeOf(sub) === ScriptCounter.prototype &&"
+        "    base instanceof NativeCounter && !(base instanceof ScriptCounter) && base.getCount() === 3;";
+    napi_value script = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, testScript, NAPI_AUTO_LENGTH, &script));
+    napi_value result = nullptr;
+    ASSERT_CHECK_CALL(napi_run_script(env, script, &result));
+    bool passed = false;
+    ASSERT_CHECK_CALL(napi_get_value_bool(env, result, &passed));
+    ASSERT_TRUE(passed);
+
+    const char* callScript =
+        "var thrown = false;"
+        "try { NativeCounter(1); } catch (e) { thrown = e instanceof TypeError; }"
+        "thrown;";
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, callScript, NAPI_AUTO_LENGTH, &script));
+    ASSERT_CHECK_CALL(napi_run_script(env, script, &result));
+    passed = false;
+    ASSERT_CHECK_CALL(napi_get_value_bool(env, result, &passed));
+    ASSERT_TRUE(passed);
+}
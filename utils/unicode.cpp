@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/unicode.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define NAPI_UNICODE_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define NAPI_UNICODE_NEON
+#endif
+
+namespace {
+constexpr uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+constexpr uint32_t MAX_CODE_POINT = 0x10FFFF;
+constexpr uint32_t MAX_BMP_CODE_POINT = 0xFFFF;
+constexpr uint32_t MAX_LATIN1_CODE_POINT = 0xFF;
+constexpr uint32_t SURROGATE_START = 0xD800;
+constexpr uint32_t SURROGATE_END = 0xDFFF;
+constexpr uint32_t LOW_SURROGATE_START = 0xDC00;
+constexpr uint32_t SUPPLEMENTARY_START = 0x10000;
+constexpr uint32_t SURROGATE_SHIFT = 10;
+constexpr uint32_t SURROGATE_MASK = 0x3FF;
+constexpr uint32_t UTF8_SHIFT = 6;
+constexpr uint32_t UTF8_CONTINUATION_MASK = 0x3F;
+constexpr uint8_t UTF8_CONTINUATION_MARK = 0x80;
+constexpr uint8_t ASCII_LIMIT = 0x80;
+constexpr size_t SIMD_WIDTH = 16;
+
+inline bool IsHighSurrogate(uint32_t unit)
+{
+    return (unit & 0xFC00) == SURROGATE_START;
+}
+
+inline bool IsLowSurrogate(uint32_t unit)
+{
+    return (unit & 0xFC00) == LOW_SURROGATE_START;
+}
+
+inline bool IsSurrogate(uint32_t codePoint)
+{
+    return codePoint >= SURROGATE_START && codePoint <= SURROGATE_END;
+}
+
+// Decode one character of at most length bytes, returns the number of bytes consumed
+size_t DecodeUtf8(const uint8_t* src, size_t length, uint32_t* codePoint)
+{
+    uint8_t lead = src[0];
+    if (lead < ASCII_LIMIT) {
+        *codePoint = lead;
+        return 1;
+    }
+
+    size_t needed = 0;
+    uint32_t result = 0;
+    uint32_t minimum = 0;
+    if ((lead & 0xE0) == 0xC0) {
+        needed = 2; // 2: 110xxxxx 10xxxxxx
+        result = lead & 0x1F;
+        minimum = 0x80;
+    } else if ((lead & 0xF0) == 0xE0) {
+        needed = 3; // 3: 1110xxxx 10xxxxxx 10xxxxxx
+        result = lead & 0x0F;
+        minimum = 0x800;
+    } else if ((lead & 0xF8) == 0xF0) {
+        needed = 4; // 4: 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+        result = lead & 0x07;
+        minimum = SUPPLEMENTARY_START;
+    } else {
+        *codePoint = REPLACEMENT_CHARACTER;
+        return 1;
+    }
+
+    if (needed > length) {
+        *codePoint = REPLACEMENT_CHARACTER;
+        return 1;
+    }
+    for (size_t i = 1; i < needed; i++) {
+        if ((src[i] & 0xC0) != UTF8_CONTINUATION_MARK) {
+            *codePoint = REPLACEMENT_CHARACTER;
+            return 1;
+        }
+        result = (result << UTF8_SHIFT) | (src[i] & UTF8_CONTINUATION_MASK);
+    }
+    if (result < minimum || result > MAX_CODE_POINT) {
+        *codePoint = REPLACEMENT_CHARACTER;
+        return 1;
+    }
+    *codePoint = result;
+    return needed;
+}
+
+inline size_t Utf8EncodedLength(uint32_t codePoint)
+{
+    if (codePoint < 0x80) {
+        return 1;
+    } else if (codePoint < 0x800) {
+        return 2; // 2: two bytes sequence
+    } else if (codePoint < SUPPLEMENTARY_START) {
+        return 3; // 3: three bytes sequence
+    }
+    return 4; // 4: four bytes sequence
+}
+
+void EncodeUtf8(uint32_t codePoint, size_t length, uint8_t* dst)
+{
+    constexpr uint8_t leadMarks[] = { 0x00, 0x00, 0xC0, 0xE0, 0xF0 };
+    for (size_t i = length - 1; i > 0; i--) {
+        dst[i] = static_cast<uint8_t>((codePoint & UTF8_CONTINUATION_MASK) | UTF8_CONTINUATION_MARK);
+        codePoint >>= UTF8_SHIFT;
+    }
+    dst[0] = static_cast<uint8_t>(codePoint | leadMarks[length]);
+}
+
+// Read one character from UTF-16, returns the number of units consumed
+inline size_t DecodeUtf16(const char16_t* src, size_t length, uint32_t* codePoint)
+{
+    uint32_t unit = src[0];
+    if (!IsSurrogate(unit)) {
+        *codePoint = unit;
+        return 1;
+    }
+    if (IsHighSurrogate(unit) && length > 1 && IsLowSurrogate(src[1])) {
+        *codePoint = SUPPLEMENTARY_START + ((unit & SURROGATE_MASK) << SURROGATE_SHIFT) + (src[1] & SURROGATE_MASK);
+        return 2; // 2: surrogate pair
+    }
+    *codePoint = REPLACEMENT_CHARACTER;
+    return 1;
+}
+
+// Widen leading ASCII bytes to UTF-16, returns the number of bytes converted
+size_t WidenAscii(const uint8_t* src, size_t length, char16_t* dst)
+{
+    size_t i = 0;
+#if defined(NAPI_UNICODE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + SIMD_WIDTH <= length; i += SIMD_WIDTH) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(bytes) != 0) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + SIMD_WIDTH / 2), _mm_unpackhi_epi8(bytes, zero));
+    }
+#elif defined(NAPI_UNICODE_NEON)
+    for (; i + SIMD_WIDTH <= length; i += SIMD_WIDTH) {
+        uint8x16_t bytes = vld1q_u8(src + i);
+        if (vmaxvq_u8(bytes) >= ASCII_LIMIT) {
+            break;
+        }
+        vst1q_u16(reinterpret_cast<uint16_t*>(dst + i), vmovl_u8(vget_low_u8(bytes)));
+        vst1q_u16(reinterpret_cast<uint16_t*>(dst + i + SIMD_WIDTH / 2), vmovl_u8(vget_high_u8(bytes)));
+    }
+#endif
+    for (; i < length && src[i] < ASCII_LIMIT; i++) {
+        dst[i] = src[i];
+    }
+    return i;
+}
+
+// Narrow leading ASCII units to UTF-8, returns the number of units converted
+size_t NarrowAscii(const char16_t* src, size_t length, uint8_t* dst)
+{
+    size_t i = 0;
+#if defined(NAPI_UNICODE_SSE2)
+    const __m128i nonAscii = _mm_set1_epi16(static_cast<int16_t>(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + SIMD_WIDTH <= length; i += SIMD_WIDTH) {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + SIMD_WIDTH / 2));
+        __m128i test = _mm_and_si128(_mm_or_si128(low, high), nonAscii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(test, zero)) != 0xFFFF) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(low, high));
+    }
+#elif defined(NAPI_UNICODE_NEON)
+    for (; i + SIMD_WIDTH <= length; i += SIMD_WIDTH) {
+        uint16x8_t low = vld1q_u16(reinterpret_cast<const uint16_t*>(src + i));
+        uint16x8_t high = vld1q_u16(reinterpret_cast<const uint16_t*>(src + i + SIMD_WIDTH / 2));
+        if (vmaxvq_u16(vorrq_u16(low, high)) >= ASCII_LIMIT) {
+            break;
+        }
+        vst1q_u8(dst + i, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+#endif
+    for (; i < length && src[i] < ASCII_LIMIT; i++) {
+        dst[i] = static_cast<uint8_t>(src[i]);
+    }
+    return i;
+}
+
+inline size_t Min(size_t a, size_t b)
+{
+    return a < b ? a : b;
+}
+} // namespace
+
+namespace Unicode {
+size_t AsciiPrefixLength(const char* str, size_t length)
+{
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(str);
+    size_t i = 0;
+#if defined(NAPI_UNICODE_SSE2)
+    for (; i + SIMD_WIDTH <= length; i += SIMD_WIDTH) {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        if (mask != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(mask)));
+        }
+    }
+#elif defined(NAPI_UNICODE_NEON)
+    for (; i + SIMD_WIDTH <= length; i += SIMD_WIDTH) {
+        if (vmaxvq_u8(vld1q_u8(src + i)) >= ASCII_LIMIT) {
+            break;
+        }
+    }
+#endif
+    while (i < length && src[i] < ASCII_LIMIT) {
+        i++;
+    }
+    return i;
+}
+
+bool IsValidUtf8(const char* str, size_t length)
+{
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(str);
+    size_t i = 0;
+    while (i < length) {
+        i += AsciiPrefixLength(str + i, length - i);
+        if (i >= length) {
+            break;
+        }
+        uint32_t codePoint = 0;
+        size_t size = DecodeUtf8(src + i, length - i, &codePoint);
+        if (IsSurrogate(codePoint) || (codePoint == REPLACEMENT_CHARACTER && size == 1)) {
+            return false;
+        }
+        i += size;
+    }
+    return true;
+}
+
+size_t Utf8ToUtf16Length(const char* str, size_t length)
+{
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(str);
+    size_t result = 0;
+    size_t i = 0;
+    while (i < length) {
+        size_t ascii = AsciiPrefixLength(str + i, length - i);
+        i += ascii;
+        result += ascii;
+        if (i >= length) {
+            break;
+        }
+        uint32_t codePoint = 0;
+        i += DecodeUtf8(src + i, length - i, &codePoint);
+        result += (codePoint > MAX_BMP_CODE_POINT) ? 2 : 1; // 2: surrogate pair
+    }
+    return result;
+}
+
+size_t Utf8ToUtf16(const char* src, size_t srcLength, char16_t* dst, size_t dstLength)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+    size_t read = 0;
+    size_t written = 0;
+    while (read < srcLength && written < dstLength) {
+        size_t ascii = WidenAscii(bytes + read, Min(srcLength - read, dstLength - written), dst + written);
+        read += ascii;
+        written += ascii;
+        if (read >= srcLength || written >= dstLength) {
+            break;
+        }
+        uint32_t codePoint = 0;
+        size_t size = DecodeUtf8(bytes + read, srcLength - read, &codePoint);
+        if (codePoint > MAX_BMP_CODE_POINT) {
+            if (dstLength - written < 2) { // 2: surrogate pair
+                break;
+            }
+            codePoint -= SUPPLEMENTARY_START;
+            dst[written++] = static_cast<char16_t>(SURROGATE_START + (codePoint >> SURROGATE_SHIFT));
+            dst[written++] = static_cast<char16_t>(LOW_SURROGATE_START + (codePoint & SURROGATE_MASK));
+        } else {
+            dst[written++] = static_cast<char16_t>(codePoint);
+        }
+        read += size;
+    }
+    return written;
+}
+
+size_t Utf16ToUtf8Length(const char16_t* str, size_t length)
+{
+    size_t result = 0;
+    size_t i = 0;
+    while (i < length) {
+        uint32_t codePoint = 0;
+        i += DecodeUtf16(str + i, length - i, &codePoint);
+        result += Utf8EncodedLength(codePoint);
+    }
+    return result;
+}
+
+size_t Utf16ToUtf8(const char16_t* src, size_t srcLength, char* dst, size_t dstLength)
+{
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(dst);
+    size_t read = 0;
+    size_t written = 0;
+    while (read < srcLength && written < dstLength) {
+        size_t ascii = NarrowAscii(src + read, Min(srcLength - read, dstLength - written), bytes + written);
+        read += ascii;
+        written += ascii;
+        if (read >= srcLength || written >= dstLength) {
+            break;
+        }
+        uint32_t codePoint = 0;
+        size_t size = DecodeUtf16(src + read, srcLength - read, &codePoint);
+        size_t encodedLength = Utf8EncodedLength(codePoint);
+        if (encodedLength > dstLength - written) {
+            break;
+        }
+        EncodeUtf8(codePoint, encodedLength, bytes + written);
+        read += size;
+        written += encodedLength;
+    }
+    return written;
+}
+
+size_t Latin1ToUtf8Length(const char* str, size_t length)
+{
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(str);
+    size_t result = length;
+    size_t i = 0;
+    while (i < length) {
+        i += AsciiPrefixLength(str + i, length - i);
+        for (; i < length && src[i] >= ASCII_LIMIT; i++) {
+            result++;
+        }
+    }
+    return result;
+}
+
+size_t Latin1ToUtf8(const char* src, size_t srcLength, char* dst, size_t dstLength)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+    uint8_t* out = reinterpret_cast<uint8_t*>(dst);
+    size_t read = 0;
+    size_t written = 0;
+    while (read < srcLength && written < dstLength) {
+        size_t ascii = AsciiPrefixLength(src + read, Min(srcLength - read, dstLength - written));
+        for (size_t i = 0; i < ascii; i++) {
+            out[written + i] = bytes[read + i];
+        }
+        read += ascii;
+        written += ascii;
+        if (read >= srcLength || written >= dstLength) {
+            break;
+        }
+        if (dstLength - written < 2) { // 2: every byte above 0x7F takes two bytes
+            break;
+        }
+        EncodeUtf8(bytes[read], 2, out + written); // 2: two bytes sequence
+        read++;
+        written += 2; // 2: two bytes sequence
+    }
+    return written;
+}
+
+size_t Utf8ToLatin1Length(const char* str, size_t length)
+{
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(str);
+    size_t result = 0;
+    size_t i = 0;
+    while (i < length) {
+        size_t ascii = AsciiPrefixLength(str + i, length - i);
+        i += ascii;
+        result += ascii;
+        if (i >= length) {
+            break;
+        }
+        uint32_t codePoint = 0;
+        i += DecodeUtf8(src + i, length - i, &codePoint);
+        result++;
+    }
+    return result;
+}
+
+size_t Utf8ToLatin1(const char* src, size_t srcLength, char* dst, size_t dstLength)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+    size_t read = 0;
+    size_t written = 0;
+    while (read < srcLength && written < dstLength) {
+        size_t ascii = AsciiPrefixLength(src + read, Min(srcLength - read, dstLength - written));
+        for (size_t i = 0; i < ascii; i++) {
+            dst[written + i] = src[read + i];
+        }
+        read += ascii;
+        written += ascii;
+        if (read >= srcLength || written >= dstLength) {
+            break;
+        }
+        uint32_t codePoint = 0;
+        read += DecodeUtf8(bytes + read, srcLength - read, &codePoint);
+        dst[written++] = static_cast<char>(codePoint & MAX_LATIN1_CODE_POINT);
+    }
+    return written;
+}
+} // namespace Unicode
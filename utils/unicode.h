@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_UTILS_UNICODE_H
+#define FOUNDATION_ACE_NAPI_UTILS_UNICODE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/macros.h"
+
+/*
+ * Transcoding helpers shared by the engine backends.
+ *
+ * Lengths are in code units of the target encoding and exclude the terminating '\0', conversions never write one.
+ * A conversion stops before the first character that does not fit in dst, surrogate pairs are never split.
+ * Malformed UTF-8 decodes to U+FFFD, encoded surrogates are accepted so lone surrogates survive a round trip.
+ * Unpaired UTF-16 surrogates are encoded as U+FFFD.
+ */
+namespace Unicode {
+// Number of leading bytes below 0x80
+NAPI_EXPORT size_t AsciiPrefixLength(const char* str, size_t length);
+
+NAPI_EXPORT bool IsValidUtf8(const char* str, size_t length);
+
+NAPI_EXPORT size_t Utf8ToUtf16Length(const char* str, size_t length);
+NAPI_EXPORT size_t Utf8ToUtf16(const char* src, size_t srcLength, char16_t* dst, size_t dstLength);
+
+NAPI_EXPORT size_t Utf16ToUtf8Length(const char16_t* str, size_t length);
+NAPI_EXPORT size_t Utf16ToUtf8(const char16_t* src, size_t srcLength, char* dst, size_t dstLength);
+
+NAPI_EXPORT size_t Latin1ToUtf8Length(const char* str, size_t length);
+NAPI_EXPORT size_t Latin1ToUtf8(const char* src, size_t srcLength, char* dst, size_t dstLength);
+
+// Characters above U+00FF keep their low byte
+NAPI_EXPORT size_t Utf8ToLatin1Length(const char* str, size_t length);
+NAPI_EXPORT size_t Utf8ToLatin1(const char* src, size_t srcLength, char* dst, size_t dstLength);
+} // namespace Unicode
+
+#endif /* FOUNDATION_ACE_NAPI_UTILS_UNICODE_H */